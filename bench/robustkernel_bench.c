@@ -0,0 +1,195 @@
+/**@file   robustkernel_bench.c
+ * @brief  compares the kernels of the robust arrival times with the generic recurrence
+ * @author Lukas Schürmann, University Bonn
+ *
+ * For every number of delays from 0 to ROBUST_KERNEL_MAXGAMMA, the kernel and the generic recurrence with a number of
+ * delays that is only known at runtime are applied to the same random arcs. The program fails if one arrival time
+ * differs, otherwise it prints the time per arc of both.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "robustkernel_vrp.h"
+
+#define NARCS                       4096        /* number of random arcs that are propagated in one pass */
+#define NPASSES                     200         /* number of passes over the arcs for the time measurement */
+
+/** one arc with the data of updateRobustTimes() */
+typedef struct _bench_arc
+{
+    int             earliestService;
+    int             noDev;
+    int             singleDev;
+    int             doubleDev;
+} bench_arc;
+
+/** the generic recurrence, it is not inlined so the number of delays is not a constant */
+static __attribute__((noinline))
+void genericRecurrence(
+    int*        robustTimes,
+    int         gammaMax,
+    int         earliestService,
+    int         noDev,
+    int         singleDev,
+    int         doubleDev
+    )
+{
+    robustTimesRecurrence(robustTimes, gammaMax, earliestService, noDev, singleDev, doubleDev);
+}
+
+/** returns the current time in nanoseconds */
+static
+double getNanoseconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/** creates random arcs, the deviations are nonnegative and the arrival times stay far below INT_MAX */
+static
+void createArcs(
+    bench_arc*  arcs,
+    int         narcs
+    )
+{
+    int i;
+
+    for (i = 0; i < narcs; i++)
+    {
+        int dev = rand() % 600;
+        arcs[i].earliestService = rand() % 2000;
+        arcs[i].noDev = rand() % 900;
+        arcs[i].singleDev = arcs[i].noDev + dev;
+        arcs[i].doubleDev = arcs[i].singleDev + rand() % 600;
+    }
+}
+
+/** propagates the arrival times along all arcs, they are reset after every 16 arcs like the start of a new tour */
+static
+void propagateKernel(
+    robust_times_kernel kernel,
+    bench_arc*  arcs,
+    int         narcs,
+    int*        robustTimes,
+    unsigned int* result
+    )
+{
+    int i;
+
+    for (i = 0; i < narcs; i++)
+    {
+        if (i % 16 == 0)
+        {
+            memset(robustTimes, 0, (ROBUST_KERNEL_MAXGAMMA + 1) * sizeof(int));
+        }
+        kernel(robustTimes, arcs[i].earliestService, arcs[i].noDev, arcs[i].singleDev, arcs[i].doubleDev);
+        *result += robustTimes[0];
+    }
+}
+
+/** same as propagateKernel(), but with the generic recurrence */
+static
+void propagateGeneric(
+    int         gammaMax,
+    bench_arc*  arcs,
+    int         narcs,
+    int*        robustTimes,
+    unsigned int* result
+    )
+{
+    int i;
+
+    for (i = 0; i < narcs; i++)
+    {
+        if (i % 16 == 0)
+        {
+            memset(robustTimes, 0, (ROBUST_KERNEL_MAXGAMMA + 1) * sizeof(int));
+        }
+        genericRecurrence(robustTimes, gammaMax, arcs[i].earliestService, arcs[i].noDev, arcs[i].singleDev,
+                          arcs[i].doubleDev);
+        *result += robustTimes[0];
+    }
+}
+
+int main(void)
+{
+    bench_arc* arcs;
+    int kernelTimes[ROBUST_KERNEL_MAXGAMMA + 1];
+    int genericTimes[ROBUST_KERNEL_MAXGAMMA + 1];
+    unsigned int result = 0;
+    int nerrors = 0;
+    int gammaMax;
+    int i;
+    int k;
+
+    arcs = malloc(NARCS * sizeof(bench_arc));
+    if (arcs == NULL)
+    {
+        return 1;
+    }
+    srand(1);
+    createArcs(arcs, NARCS);
+
+    printf("gamma  kernel [ns/arc]  generic [ns/arc]\n");
+    for (gammaMax = 0; gammaMax <= ROBUST_KERNEL_MAXGAMMA; gammaMax++)
+    {
+        robust_times_kernel kernel = robustTimesKernels[gammaMax];
+        double start;
+        double kernelTime;
+        double genericTime;
+
+        /* both must compute the same arrival times on every arc */
+        memset(kernelTimes, 0, sizeof(kernelTimes));
+        memset(genericTimes, 0, sizeof(genericTimes));
+        for (i = 0; i < NARCS; i++)
+        {
+            kernel(kernelTimes, arcs[i].earliestService, arcs[i].noDev, arcs[i].singleDev, arcs[i].doubleDev);
+            genericRecurrence(genericTimes, gammaMax, arcs[i].earliestService, arcs[i].noDev, arcs[i].singleDev,
+                              arcs[i].doubleDev);
+            for (k = 0; k <= gammaMax; k++)
+            {
+                if (kernelTimes[k] != genericTimes[k])
+                {
+                    printf("gamma %d, arc %d: kernel arrival %d with %d delays, generic arrival %d\n", gammaMax, i,
+                           kernelTimes[k], k, genericTimes[k]);
+                    nerrors++;
+                }
+            }
+            if (i % 16 == 15)
+            {
+                memset(kernelTimes, 0, sizeof(kernelTimes));
+                memset(genericTimes, 0, sizeof(genericTimes));
+            }
+        }
+
+        start = getNanoseconds();
+        for (i = 0; i < NPASSES; i++)
+        {
+            propagateKernel(kernel, arcs, NARCS, kernelTimes, &result);
+        }
+        kernelTime = (getNanoseconds() - start) / ((double) NPASSES * NARCS);
+
+        start = getNanoseconds();
+        for (i = 0; i < NPASSES; i++)
+        {
+            propagateGeneric(gammaMax, arcs, NARCS, genericTimes, &result);
+        }
+        genericTime = (getNanoseconds() - start) / ((double) NPASSES * NARCS);
+
+        printf("%5d  %15.2f  %16.2f\n", gammaMax, kernelTime, genericTime);
+    }
+    /* keeps the propagations from being removed */
+    printf("checksum %u\n", result);
+    free(arcs);
+
+    if (nerrors > 0)
+    {
+        printf("%d arrival times of the kernels differ from the generic recurrence\n", nerrors);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,59 @@
+/**@file   completionbound_vrp.h
+ * @brief  lower bounds on the reduced costs to complete a tour, used to prune labels in exact pricing
+ * @author Lukas Schürmann, University Bonn
+ *
+ * For each customer of a day and each time bucket, the table contains a lower bound on the reduced costs of a path
+ * from the customer back to the depot, if the customer is reached at the start of the bucket or later. The bounds are
+ * computed by a backward dynamic program over the buckets on a relaxation of the pricing problem: customers may be
+ * visited more than once, the arrival times are computed without delays (Gamma = 0), and the nonnegative window
+ * weights and delay costs are left out. The travel times are assumed to be FIFO, i.e. a later departure never leads
+ * to an earlier arrival.
+ */
+
+#ifndef __COMPLETIONBOUND_VRP_H__
+#define __COMPLETIONBOUND_VRP_H__
+
+#include "scip/scip.h"
+
+#include "tools_data.h"
+#include "pricingcontext_vrp.h"
+
+typedef struct _completion_bound
+{
+    double*         bounds;                 /**< (nC x nbuckets)-array, lower bound on the reduced costs to complete a
+                                             *   tour from a customer that is reached in a bucket */
+    int             nC;                     /**< number of customers + depot */
+    int             nbuckets;               /**< number of time buckets */
+    int             bucketsize;             /**< length of a bucket in seconds */
+    int             start;                  /**< start of the first bucket, the start of the shift */
+} completion_bound;
+
+/**
+ * Computes the completion bounds of a day for the dual values of the pricing context
+ * @param bound pointer to store the bounds, NULL if the buckets would be empty because of zero service and travel
+ *              times */
+SCIP_RETCODE completionBoundCreate(
+    SCIP*           scip,
+    pricing_context* context,
+    completion_bound** bound,
+    int             day
+);
+
+/** Frees the completion bounds */
+void completionBoundFree(
+    SCIP*           scip,
+    completion_bound** bound
+);
+
+/**
+ * Returns a lower bound on the reduced costs to complete a tour from a customer
+ * @param node customer at which the tour is continued
+ * @param arrivaltime arrival time without delays at node
+ * @return lower bound on the reduced costs of the path from node to the depot, SCIP_DEFAULT_INFINITY if there is none */
+double completionBoundGet(
+    completion_bound* bound,
+    int             node,
+    int             arrivaltime
+);
+
+#endif
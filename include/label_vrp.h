@@ -11,16 +11,20 @@
 #include "scip/cons_setppc.h"
 
 #include "tools_data.h"
+#include "labelarena_vrp.h"
+#include "pricingcontext_vrp.h"
 
 typedef struct _labelVrp
 {
     int             node;                   /** current node at which this label is present */
     double          redcost;                /** accumulated reduced costs on this path */
     double          collactableRedcost;     /** reduced costs which could still be collected */
-    int*            bitVisitednodes;        /** nC-bit-array of visitednodes */
+    int*            bitVisitednodes;        /** nC-bit-array of visitednodes, for ng-route labels only the visited nodes
+                                             *  in the ng-neighborhood of node */
     int             sizeBitarray;           /** = (modeldata->nC/INT_BIT_SIZE + 1) */
-    int*            visitednodes;           /** sequence of all already visited nodes */
-    int             nvisitednodes;          /** size of visitednodes */
+    struct _labelVrp* parent;               /** label from which this label was propagated, NULL at the depot,
+                                             *  the sequence of visited nodes is given by the chain of parents */
+    int             nvisitednodes;          /** number of visited nodes, i.e. length of the chain of parents */
     int             starttime;              /** time at which the tour started at the depot (currently no further use!) */
     int             day;                    /** day on which this tour is planned */
     int*            arrivaltimes;           /** array of all (delayed) arrival times at this node */ 
@@ -30,11 +34,13 @@ typedef struct _labelVrp
     SCIP_Bool       isDominated;
     double          lhs;
     int             nEC;
+    label_arena*    arena;                  /** arena from which the label was allocated, NULL if it was allocated by SCIP */
 } labelVrp;
 
-/** Creates an empty label at the depot node */
+/** Creates an empty label at the depot node, if arena is NULL the label is allocated by SCIP */
 SCIP_RETCODE labelVrpCreateEmpty(
     SCIP*           scip, 
+    label_arena*    arena,
     labelVrp**      label,
     int             ncustomers,
     int             narrivaltimes,
@@ -43,14 +49,14 @@ SCIP_RETCODE labelVrpCreateEmpty(
     int             day
 );
 
-/** Creates a label at node */
+/** Creates a label at node as successor of parent, if arena is NULL the label is allocated by SCIP */
 SCIP_RETCODE labelVrpCreate(
     SCIP*           scip, 
+    label_arena*    arena,
     labelVrp**      label,
+    labelVrp*       parent,
     int             node,
     int             ncustomers,
-    int*            visitednodes,
-    int             nvisitednodes,
     int*            arrivaltimes,
     int             narrivaltimes,
     double          redcost,
@@ -66,16 +72,20 @@ SCIP_RETCODE labelVrpFree(
     labelVrp**      label
 );
 
-/** Propagate a label to destination */
+/**
+ * Propagate a label to destination, the new label is allocated from arena
+ * @param context data of the pricing call, the propagation makes no calls to SCIP except for the allocation
+ * @param ngSet bit array of the ng-neighborhood of destination, the new label only remembers the visited customers
+ *              of this set; NULL if the label has to be elementary */
 SCIP_RETCODE labelVrpPropagate(
     SCIP*           scip,
-    SCIP_PRICERDATA* pricerdata,
-    model_data*     modeldata,
+    label_arena*    arena,
+    pricing_context* context,
     labelVrp*       oldLabel,
     labelVrp**      newLabel,
     int             destination,
     double          dualvalue,
-    SCIP_Bool       isFarkas
+    int*            ngSet
 );
 
 /**
@@ -92,18 +102,55 @@ SCIP_Bool labelVrpDominates(
 
 /**
  * computes still collectable dualvalues for a given label
+ * @param context data of the pricing call with the dual values
  * @param label label with arivaltimes and current day
- * @param dualvalues dualvalues
  * @param upperTimeWindows nC-array with the last possible arrivaltime for each customer, 
  *                         this equals upper boundary of time window when customer has time window on this day
  *                         in all other cases the value is zero
+ * @param pathVisited bit array of the customers on the path of label, if label is an ng-route label that does not
+ *                    remember all of them; NULL else
  * @return negative sum over all reduced cost that still could be collected for this label*/
 double labelVrpCollactableRedCostTimeDependent(
-    SCIP*           scip,
-    model_data*     modeldata,
+    pricing_context* context,
+    labelVrp*       label,
+    int*            upperTimeWindows,
+    int*            pathVisited
+);
+
+/** Writes the bit array of the customers on the path of a label, the parents of the label must not be freed yet */
+void labelVrpGetPathVisited(
     labelVrp*       label,
-    double*         dualvalues,
-    int*            upperTimeWindows
+    int*            pathVisited
+);
+
+/**
+ * Checks if no customer is visited twice on the path of a label, ng-route labels may contain cycles
+ * @return TRUE if the path of label is elementary,
+ *         FALSE else */
+SCIP_Bool labelVrpIsElementary(
+    labelVrp*       label
+);
+
+/**
+ * Sets the bits of all customers that are visited more than once on the path of a label, the other bits of
+ * repeatedNodes are not changed */
+void labelVrpAddRepeatedNodes(
+    labelVrp*       label,
+    int*            repeatedNodes
+);
+
+/**
+ * Writes the sequence of visited nodes of a label, the parents of the label must not be freed yet
+ * @param label label at the end of the path
+ * @param path array of size label->nvisitednodes to store the visited nodes in */
+void labelVrpGetPath(
+    labelVrp*       label,
+    int*            path
+);
+
+/** Print the visited nodes of a label */
+void labelVrpPrintPath(
+    labelVrp*       label
 );
 
 /** Print label data */
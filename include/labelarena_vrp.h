@@ -0,0 +1,98 @@
+/**@file   labelarena_vrp.h
+ * @brief  bump allocator for labels and labellists of one labeling run
+ * @author Lukas Schürmann, University Bonn
+ *
+ * All labels of one call of the labeling algorithm are taken from an arena. The memory is handed out in large chunks
+ * and is given back in bulk, when the labeling algorithm returns. A single block can only be released, if it is on top
+ * of the arena, which is the typical case for a propagated label that is immediately rejected. Blocks that were
+ * handed out one after another can be released in reverse order.
+ * An arena must only be used by one thread at a time. Threads that work on the same labeling run take their labels from
+ * child arenas, which are reset and freed together with their parent.
+ * The chunks are taken from the memory pool of the calling thread (see threadmemory_vrp.h), not from SCIP.
+ */
+
+#ifndef __LABELARENA_VRP_H__
+#define __LABELARENA_VRP_H__
+
+#include "scip/scip.h"
+
+#define LABEL_ARENA_CHUNKSIZE       (1 << 20)   /* INT,        size of a single memory chunk of the label arena in bytes */
+#define LABEL_ARENA_ALIGNMENT       16          /* INT,        alignment of every block handed out by the label arena */
+
+/** returns the size of a block rounded up to the alignment of the arena */
+#define labelArenaAlignedSize(size) ( ((size_t) (size) + LABEL_ARENA_ALIGNMENT - 1) & ~((size_t) LABEL_ARENA_ALIGNMENT - 1) )
+
+typedef struct _label_arena_chunk
+{
+    struct _label_arena_chunk*  next;       /**< next chunk of the arena */
+    size_t                      capacity;   /**< number of usable bytes in this chunk */
+    size_t                      used;       /**< number of bytes already handed out */
+    size_t                      padding;    /**< keeps the data behind the header aligned */
+} label_arena_chunk;
+
+typedef struct _label_arena
+{
+    label_arena_chunk*  chunks;             /**< first chunk of the arena */
+    label_arena_chunk*  current;            /**< chunk from which memory is handed out at the moment */
+    size_t              chunksize;          /**< default capacity of a new chunk */
+    struct _label_arena** children;         /**< child arenas, created on demand */
+    int                 nchildren;          /**< number of child arenas */
+} label_arena;
+
+/** Creates an empty arena, chunks are allocated on demand */
+SCIP_RETCODE labelArenaCreate(
+    SCIP*               scip,
+    label_arena**       arena,
+    size_t              chunksize
+);
+
+/** Frees the arena and all of its chunks */
+SCIP_RETCODE labelArenaFree(
+    SCIP*               scip,
+    label_arena**       arena
+);
+
+/**
+ * Hands out a block of the given size
+ * @param scip scip instance, unused, a new chunk is taken from the memory pool of the calling thread
+ * @param arena arena
+ * @param block pointer to store the address of the block
+ * @param size size of the block in bytes */
+SCIP_RETCODE labelArenaAlloc(
+    SCIP*               scip,
+    label_arena*        arena,
+    void**              block,
+    size_t              size
+);
+
+/**
+ * Gives a block back to the arena. The memory is only reused if the block is on top of the arena,
+ * all other blocks stay allocated until the arena is reset.
+ * @param arena arena
+ * @param block block to release
+ * @param size size of the block in bytes, as given to labelArenaAlloc() */
+void labelArenaRelease(
+    label_arena*        arena,
+    void*               block,
+    size_t              size
+);
+
+/** Releases all blocks at once, also the ones of the child arenas, the chunks are kept for the next labeling run */
+void labelArenaReset(
+    label_arena*        arena
+);
+
+/**
+ * Returns a child arena, which is created on demand. Its blocks stay valid until the parent is reset or freed.
+ * @param scip scip instance, unused, a new child is taken from the memory pool of the calling thread
+ * @param arena parent arena
+ * @param i number of the child
+ * @param child pointer to store the child arena */
+SCIP_RETCODE labelArenaGetChild(
+    SCIP*               scip,
+    label_arena*        arena,
+    int                 i,
+    label_arena**       child
+);
+
+#endif
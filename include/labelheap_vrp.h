@@ -0,0 +1,69 @@
+/**@file   labelheap_vrp.h
+ * @brief  binary heap of labellists, ordered by their value
+ * @author Lukas Schürmann, University Bonn
+ *
+ * Every labellist knows its position in the heap, so that it can be removed from the heap when its label gets
+ * dominated. Labellists with equal values are extracted in reverse order of their insertion.
+ */
+
+#ifndef __LABELHEAP_VRP_H__
+#define __LABELHEAP_VRP_H__
+
+#include "scip/scip.h"
+#include "labellist_vrp.h"
+
+typedef struct _label_heap
+{
+    label_list**    entries;                /**< labellists in heap order */
+    int             nentries;               /**< number of labellists in the heap */
+    int             size;                   /**< size of entries */
+    SCIP_Longint    ninserted;              /**< number of insertions so far, used to break ties */
+} label_heap;
+
+/** Initializes an empty heap */
+void labelHeapInit(
+    label_heap*     heap
+);
+
+/** Creates an empty heap */
+SCIP_RETCODE labelHeapCreate(
+    SCIP*           scip,
+    label_heap**    heap
+);
+
+/** Frees the memory of a heap that was initialized by labelHeapInit(), the labellists are not touched */
+void labelHeapExit(
+    SCIP*           scip,
+    label_heap*     heap
+);
+
+/** Frees a heap that was created by labelHeapCreate(), the labellists are not touched */
+SCIP_RETCODE labelHeapFree(
+    SCIP*           scip,
+    label_heap**    heap
+);
+
+/** Removes all labellists from the heap, the labellists are not touched */
+void labelHeapClear(
+    label_heap*     heap
+);
+
+/** Inserts a labellist with the key list->value */
+SCIP_RETCODE labelHeapInsert(
+    SCIP*           scip,
+    label_heap*     heap,
+    label_list*     list
+);
+
+/** Removes and returns the labellist with the smallest value, NULL if the heap is empty */
+label_list* labelHeapExtractMin(
+    label_heap*     heap
+);
+
+/** Removes a labellist from the heap, nothing happens if it is not contained in the heap */
+void labelHeapRemove(
+    label_heap*     heap,
+    label_list*     list
+);
+
+#endif
@@ -0,0 +1,130 @@
+/**@file   labelindex_vrp.h
+ * @brief  per-node index of labels for the dominance check
+ * @author Lukas Schürmann, University Bonn
+ *
+ * The active and the propagated labels of every customer are stored in buckets by their first arrival time.
+ * Each bucket knows the range of reduced costs of its labels, so that a dominance check only has to look at buckets
+ * that can contain a dominating or a dominated label.
+ *
+ * Inside a bucket, the resources of the labels are stored as structure of arrays. The arrival times and the visited
+ * customers are stored column by column, i.e. all values of one resource for consecutive labels are consecutive.
+ * A new label is compared to a whole block of LABEL_INDEX_BLOCKSIZE labels at once with branch free loops over these
+ * columns, which are vectorized by the compiler.
+ */
+
+#ifndef __LABELINDEX_VRP_H__
+#define __LABELINDEX_VRP_H__
+
+#include <stdint.h>
+
+#include "scip/scip.h"
+#include "labellist_vrp.h"
+
+#define LABEL_INDEX_NBUCKETS        32          /* INT,        number of arrival time buckets per customer in the dominance index */
+#define LABEL_INDEX_BLOCKSIZE       8           /* INT,        number of labels that are compared at once in the dominance check */
+
+typedef struct _label_bucket
+{
+    label_list**    entries;                /**< labellists of all labels in this bucket */
+    double*         redcost;                /**< reduced costs of the labels */
+    int*            nvisitednodes;          /**< number of visited nodes of the labels */
+    int*            starttime;              /**< start times of the labels */
+    int*            arrivaltimes;           /**< arrival time i of label j is stored at position i * size + j */
+    uint64_t*       visited;                /**< word w of the visited bit array of label j is stored at position w * size + j */
+    int             nentries;               /**< number of labels in this bucket */
+    int             size;                   /**< size of the arrays, always a multiple of LABEL_INDEX_BLOCKSIZE */
+    double          minRedcost;             /**< lower bound on the reduced costs of the labels in this bucket */
+    double          maxRedcost;             /**< upper bound on the reduced costs of the labels in this bucket */
+} label_bucket;
+
+typedef struct _label_index
+{
+    label_bucket*   buckets;                /**< nnodes * nbuckets buckets, the buckets of one node are consecutive */
+    int             nnodes;                 /**< number of nodes, labels at the depot are not indexed */
+    int             nbuckets;               /**< number of buckets per node */
+    int             starttime;              /**< start of the first bucket */
+    int             bucketwidth;            /**< length of the time interval of one bucket */
+    int             narrivaltimes;          /**< number of arrival times of every label */
+    int             nwords;                 /**< number of 64 bit words of the visited bit arrays */
+    double          sumepsilon;             /**< tolerance for the comparison of reduced costs */
+    double          probeRedcost;           /**< reduced costs of the label that is checked at the moment */
+    int             probeNvisitednodes;     /**< number of visited nodes of the label that is checked at the moment */
+    int             probeStarttime;         /**< start time of the label that is checked at the moment */
+    int*            probeArrivaltimes;      /**< arrival times of the label that is checked at the moment */
+    int*            probeDifferences;       /**< differences of successive arrival times of this label */
+    uint64_t*       probeVisited;           /**< visited bit array of this label */
+    SCIP_Longint    ncompared;              /**< number of label pairs that were compared */
+    SCIP_Longint    nskipped;               /**< number of label pairs that were skipped by the bucket bounds */
+} label_index;
+
+/** returns the bucket of a node for an arrival time */
+#define labelIndexGetBucket(index, node, time) \
+    ( &(index)->buckets[(node) * (index)->nbuckets \
+        + MAX(0, MIN((index)->nbuckets - 1, ((time) - (index)->starttime) / (index)->bucketwidth))] )
+
+/**
+ * Creates an empty index
+ * @param scip scip instance
+ * @param index pointer to store the index
+ * @param nnodes number of nodes with labels
+ * @param narrivaltimes number of arrival times of every label
+ * @param sizeBitarray number of int words of the visited bit array of every label
+ * @param starttime earliest arrival time of a label, i.e. start of the shift
+ * @param endtime latest arrival time of a label, i.e. end of the shift */
+SCIP_RETCODE labelIndexCreate(
+    SCIP*           scip,
+    label_index**   index,
+    int             nnodes,
+    int             narrivaltimes,
+    int             sizeBitarray,
+    int             starttime,
+    int             endtime
+);
+
+/** Frees the index, the labels are not touched */
+SCIP_RETCODE labelIndexFree(
+    SCIP*           scip,
+    label_index**   index
+);
+
+/** Adds the label of a labellist to the index */
+SCIP_RETCODE labelIndexInsert(
+    SCIP*           scip,
+    label_index*    index,
+    label_list*     list
+);
+
+/** Removes the label of a labellist from the index */
+void labelIndexRemove(
+    label_index*    index,
+    label_list*     list
+);
+
+/** Sets the label that is compared to the labels of the index by the following calls */
+void labelIndexSetProbe(
+    label_index*    index,
+    labelVrp*       label
+);
+
+/**
+ * Searches a label in a bucket that dominates the probe label
+ * @return position of the first dominating label in the bucket, -1 if there is none */
+int labelIndexFindDominating(
+    label_index*    index,
+    label_bucket*   bucket
+);
+
+/**
+ * Checks which labels of a block of a bucket are dominated by the probe label
+ * @param index index
+ * @param bucket bucket
+ * @param blockstart first position of the block, a multiple of LABEL_INDEX_BLOCKSIZE
+ * @param isDominated array of size LABEL_INDEX_BLOCKSIZE to store for each label of the block if it is dominated */
+void labelIndexGetDominated(
+    label_index*    index,
+    label_bucket*   bucket,
+    int             blockstart,
+    int*            isDominated
+);
+
+#endif
@@ -8,20 +8,29 @@
 
 #include "scip/scip.h"
 #include "labellist_vrp.h"
+#include "labelarena_vrp.h"
+#include "labelheap_vrp.h"
+#include "pricingcontext_vrp.h"
 #include "tools_vrp.h"
 
 /** struct to pass arguments for labeling to worker threads */
 typedef struct _arg_struct {
    SCIP*                scip;
-   SCIP_Bool            isFarkas;        /**< TRUE for farkas-pricing, FALSE for redcost-pricing */
+   pricing_context*     context;         /**< read-only data of the pricing call, shared by all days */
    SCIP_Bool            isHeuristic;
    int                  day;
    SCIP_Bool*           visited;
-   SCIP_Bool*           toDepot;
-   label_list*          bestLabels;
+   label_heap*          bestLabels;
+   label_arena*         arena;           /**< arena of this thread, contains the best labels and their parents */
+   double               minRedCost;      /**< smallest negative reduced costs of a tour of the day, 0 if there is none */
+   SCIP_Bool            isProven;        /**< TRUE if no tour of the day has smaller reduced costs */
 } arg_struct;
 
-/** labeling algorithm on one thread */
+/**
+ * labeling algorithm on one thread
+ * @param minRedCosts nDays-array to store the smallest negative reduced costs of the tours of each day, also of the
+ *                    ones that are already contained in the master problem, 0 if there is none; NULL if not needed
+ * @param isProven nDays-array to store whether no tour of a day has smaller reduced costs, NULL if minRedCosts is */
 SCIP_RETCODE labelingAlgorithmIterativ(
         SCIP*                scip,
         SCIP_Bool            isFarkas,        /**< TRUE for farkas-pricing, FALSE for redcost-pricing */
@@ -29,17 +38,28 @@ SCIP_RETCODE labelingAlgorithmIterativ(
         int                  nDays,
         tuple*               days,
         SCIP_Bool*           visited,
-        SCIP_Bool*           toDepot
+        SCIP_Bool*           toDepot,
+        double*              minRedCosts,
+        SCIP_Bool*           isProven
    );
 
-/** Same as labeling Algorithm, but uses a different thread for each day */
+/**
+ * Same as labeling Algorithm, but runs the days in parallel
+ * @param days order in which the tours of the days are added, in heuristic labeling a day keeps the customers of its
+ *             tours and later days have to avoid them; NULL for the order of the day numbers
+ * @param visited customers that are visited by a new tour, only in heuristic labeling, NULL else
+ * @param minRedCosts see labelingAlgorithmIterativ(), NULL if not needed
+ * @param isProven see labelingAlgorithmIterativ(), NULL if minRedCosts is */
 SCIP_RETCODE labelingAlgorithmParallel(
    SCIP*                scip,
    SCIP_Bool            isFarkas,        /**< TRUE for farkas-pricing, FALSE for redcost-pricing */
    SCIP_Bool            isHeuristic,
    int                  nDays,
+   tuple*               days,
    SCIP_Bool*           visited,
-   SCIP_Bool*           toDepot
+   SCIP_Bool*           toDepot,
+   double*              minRedCosts,
+   SCIP_Bool*           isProven
    );
 
 #endif
\ No newline at end of file
@@ -1,5 +1,5 @@
 /**@file   labellist_vrp.h
- * @brief  sorted list with labels, so that labels are picked in specified order (e.g. smallest reduced costs)
+ * @brief  nodes of the label tree, the labels are picked from heaps in specified order (e.g. smallest reduced costs)
  * @author Tim Niemann, TU Braunschweig
  */
 
@@ -9,16 +9,26 @@
 #include "scip/scip.h"
 #include "label_vrp.h"
 
+struct _label_bucket;
+struct _label_index;
+struct _label_heap;
+
 typedef struct _label_list {
     labelVrp*                label;
-    double                   value;
-    struct _label_list*      next;
-    struct _label_list*      prev;
+    double                   value;         /** key for the order in a heap */
     struct _label_list*      child;
     struct _label_list*      nextSibling;
     struct _label_list*      prevSibling;
     struct _label_list*      parent;
     SCIP_Bool                isPropagated;
+    label_arena*             arena;         /** arena of the label, the list node is taken from the same arena */
+    struct _label_bucket*    bucket;        /** bucket of the dominance index containing this label, NULL if not indexed */
+    int                      bucketpos;     /** position in the bucket */
+    int                      heappos;       /** position in a heap, -1 if not contained in a heap */
+    SCIP_Longint             order;         /** number of the insertion into the heap, breaks ties of value */
+    int                      nextNeighbor;  /** first sorted neighbor the label was not propagated to in an earlier
+                                             *  round, 0 if it was not propagated yet, -1 if it reached all neighbors */
+    int                      npropagated;   /** number of labels that were added by the propagation to neighbors */
 } label_list;
 
 /** Free labellist data */
@@ -27,7 +37,7 @@ SCIP_RETCODE labellistFree(
         label_list**            list
 );
 
-/** Create empty labellist*/
+/** Create empty labellist, the node is allocated from the arena of the label if it has one */
 SCIP_RETCODE labellistCreate(
     SCIP*                   scip, 
     label_list**            list, 
@@ -35,64 +45,31 @@ SCIP_RETCODE labellistCreate(
     double                  value
     );
 
-/** Destroys a label list, i.e. free every attached labellist */
-SCIP_RETCODE labellistDestroy(
-    SCIP*                   scip,
-    label_list*             list
-    );
-
-/** Inserts a label into a labellist */
-SCIP_RETCODE labellistInsert(
-    SCIP*                   scip,
-    label_list**            list, 
-    labelVrp*               label,
-    double                  value
-    );
-
-/** Inserts a label into a labellist and save its address */
-SCIP_RETCODE labellistInsertNew(
-        SCIP*                   scip,
-        label_list**            list,
-        labelVrp*               label,
-        label_list**            newNode,
-        double                  value
-);
-
-/** Removes and gets first element of labellist */
-SCIP_RETCODE labellistExtractFirst(
-    SCIP*                   scip, 
-    label_list**            list,
-    labelVrp**              label
-    );
-
 /**
- * Checks if this labels dominates a label in the list or vice versa
+ * Checks if a new label is dominated by an active or propagated label at its node, or if it dominates some of them.
+ * Only the buckets of the index are compared, which can contain a dominating or dominated label.
+ * Dominated active labels are deleted, dominated propagated labels are deleted together with all their descendants.
+ * A propagated label that was opened again for a larger neighborhood is also removed from its heap.
  * @param scip scip instance
- * @param list list with all other labels
+ * @param index dominance index with all active and propagated labels
+ * @param openLabels heaps of the active labels of all customers
  * @param label new label to be checked for dominance
- * @return -1 if this label is dominated by a label in the list, 
- *          0 if there is no dominance relation to other labels,
- *          i >= 1 if this label dominates i labels already in the list */
-int labellistDominanceCheck(
+ * @param isDominated pointer to store if the new label is dominated by a label of the index
+ * @param deletedLabels pointer to increase by the number of deleted active labels
+ * @param nUsedLabels number of propagated labels of every customer, updated for deleted labels */
+SCIP_RETCODE labellistDominanceCheck(
     SCIP*                   scip,
-    label_list**            allLists,
-    label_list**            list,
+    struct _label_index*    index,
+    struct _label_heap*     openLabels,
     labelVrp*               label,
-    SCIP_Bool               usedlabels,
+    SCIP_Bool*              isDominated,
     int*                    deletedLabels,
     int*                    nUsedLabels
     );
 
-void labellistPrint(
-    label_list*             list
-    );
-
+/** Prints the visited nodes of the label of a labellist */
 void labellistPrintFirstShort(
     label_list*             list
-    );    
-
-int labellistLength(
-    label_list*         list
     );
 
 #endif
\ No newline at end of file
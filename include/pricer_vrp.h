@@ -11,6 +11,10 @@
 #include "vardata_vrp.h"
 #include "labellist_vrp.h"
 #include "label_vrp.h"
+#include "threadpool_vrp.h"
+#include "threadmemory_vrp.h"
+#include "warmstart_vrp.h"
+#include "stabilization_vrp.h"
 
 #define ENFORCED_PRICE_COLLECTING 100000
 
@@ -27,7 +31,7 @@ struct SCIP_PricerData
    int                   nDays;              /**< number of days */
    model_data*           modeldata;          /**< model data */
    SCIP_CONSHDLR*        conshdlr;           /**< constraint handler for arc flow constraints */
-   neighbor***           neighbors;          /**< local neighborhood */
+   neighbor_graph*       neighborGraph;      /**< local neighborhood */
    int                   lastnodeid;         /**< branching node id of last iteration */
    SCIP_Bool*            toDepot;            /**< is arc to depot still active during branching */
    SCIP_Bool**           isForbidden;        /**< matrix that indicates if an arc between two customers if forbidden due to arc flow branching */
@@ -35,6 +39,9 @@ struct SCIP_PricerData
    SCIP_Bool**           timetable;
    int*                  nEC;
    int*                  eC;
+   thread_pool*          pool;               /**< threads that run the exact labeling, alive as long as the pricer */
+   warm_start*           warmstart;          /**< paths of the best labels of the last exact labeling of each day */
+   dual_stabilization*   stabilization;      /**< smoothing of the dual values of reduced cost pricing, NULL if not used */
 };
 
 /** creates the vrp variable pricer and includes it in SCIP */
@@ -0,0 +1,68 @@
+/**@file   pricingcontext_vrp.h
+ * @brief  read-only snapshot of the data of one pricing call, shared by all labeling threads
+ * @author Lukas Schürmann, University Bonn
+ *
+ * The context is created once per pricing call on the thread that calls the pricer. It contains the dual values and
+ * copies or references of the problem and pricer data that the labeling reads, so that the labels can be propagated
+ * without calls to SCIP. None of the referenced data may change until the context is freed.
+ */
+
+#ifndef __PRICINGCONTEXT_VRP_H__
+#define __PRICINGCONTEXT_VRP_H__
+
+#include <time.h>
+
+#include "scip/scip.h"
+
+#include "tools_data.h"
+#include "threadpool_vrp.h"
+
+struct _warm_start;
+
+typedef struct _pricing_context
+{
+    model_data*     modeldata;              /**< model data */
+    double*         dualvalues;             /**< (nC - 1 + nDays)-array, dual or farkas values of the customer and day
+                                             *   constraints */
+    double*         possibleDualvalues;     /**< nDays-array, sum of the dual values that a tour of a day could collect */
+    SCIP_Bool       isFarkas;               /**< TRUE for farkas-pricing, FALSE for redcost-pricing */
+    double          alphas[3];              /**< weights of the delay, travel time and window weight objectives */
+    int             delayTolerance;         /**< delay that is not penalized */
+    int**           shortestEdge;           /**< (nDays x nC)-array, shortest incoming arc of a customer on a day */
+    SCIP_Bool       useOptionals;           /**< if set, the optional customers are price collecting */
+    SCIP_Bool*      optionalCustomers;      /**< nC-array, TRUE for the optional customers */
+    neighbor_graph* neighborGraph;          /**< neighbors of each customer and day after branching */
+    SCIP_Bool**     isForbidden;            /**< (nC x nC)-array, TRUE if the arc is forbidden by branching */
+    int*            eC;                     /**< nC-array, day on which a customer is enforced, -1 if there is none */
+    int*            nEC;                    /**< nDays-array, number of enforced customers of a day */
+    SCIP_Bool*      toDepot;                /**< nC-array, FALSE if the arc from a customer to the depot is forbidden */
+    double          sumepsilon;             /**< epsilon of SCIPisSumPositive() and SCIPisSumNegative() */
+    time_t          deadline;               /**< time at which the solving time limit is reached */
+    thread_pool*    pool;                   /**< thread pool of the pricer */
+    struct _warm_start* warmstart;          /**< paths of the last exact labeling of each day, NULL if not used; the
+                                             *   only data that is written, every day writes its own paths */
+} pricing_context;
+
+/** same as SCIPisSumPositive(), without a call to SCIP */
+#define contextIsSumPositive(context, val)  ((val) > (context)->sumepsilon)
+
+/** same as SCIPisSumNegative(), without a call to SCIP */
+#define contextIsSumNegative(context, val)  ((val) < -(context)->sumepsilon)
+
+/**
+ * Creates the context of a pricing call, queries the dual values of the current LP
+ * @param toDepot nC-array, FALSE if the arc from a customer to the depot is forbidden */
+SCIP_RETCODE pricingContextCreate(
+    SCIP*           scip,
+    pricing_context** context,
+    SCIP_Bool       isFarkas,
+    SCIP_Bool*      toDepot
+);
+
+/** Frees the context of a pricing call */
+void pricingContextFree(
+    SCIP*           scip,
+    pricing_context** context
+);
+
+#endif
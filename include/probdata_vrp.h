@@ -17,6 +17,7 @@
 struct SCIP_ProbData
 {
    SCIP_VAR**            vars;               /**< all exiting variables in the problem */
+   SCIP_HASHTABLE*       tourtable;          /**< the variables hashed by their day and sequence of customers */
    SCIP_CONS**           conss;              /**< set partitioning constraints for each customer exactly one and one for the number of tours*/
    int                   nvars;              /**< number of generated variables */
    int                   varssize;           /**< size of the variable array, always greater or equals to nvars */
@@ -51,14 +52,28 @@ SCIP_RETCODE SCIPprobdataAddVar(
    );
 
 /**
- * Check by name, if a potential new variable was already added to the master problem
- * @param name variable name to check
+ * Find the variable of a tour in the master problem
  * @param probdata problem data which contains all previously generated variables
- * @return TRUE, if this variable is already contained in the master problem;
- *         FALSE, if this varibale name is not found */
+ * @return the first variable that was added with this day and sequence of customers;
+ *         NULL, if this tour is not found */
 extern
-SCIP_Bool SCIPprobdataContainsVar(
+SCIP_VAR* SCIPprobdataGetTourVar(
    SCIP_PROBDATA*        probdata,           /**< problem data */
-   const char*           name                /**< variables name to check */
+   int*                  tour,               /**< sequence of visited customers (without depot) */
+   int                   tourlength,         /**< number of visited customers */
+   int                   day                 /**< day of the tour */
+   );
+
+/**
+ * Check by its tour, if a potential new variable was already added to the master problem
+ * @param probdata problem data which contains all previously generated variables
+ * @return TRUE, if a variable with this day and sequence of customers is already contained in the master problem;
+ *         FALSE, if this tour is not found */
+extern
+SCIP_Bool SCIPprobdataContainsTour(
+   SCIP_PROBDATA*        probdata,           /**< problem data */
+   int*                  tour,               /**< sequence of visited customers (without depot) */
+   int                   tourlength,         /**< number of visited customers */
+   int                   day                 /**< day of the tour */
    );
 #endif
@@ -0,0 +1,84 @@
+/**@file   robustkernel_vrp.h
+ * @brief  recurrence of the robust arrival times, specialized for each number of delays
+ * @author Lukas Schürmann, University Bonn
+ *
+ * The arrival times with up to gamma delays at a customer are computed from the ones at its predecessor. For up to
+ * ROBUST_KERNEL_MAXGAMMA delays, there is a kernel with a constant number of delays, whose loop is unrolled completely.
+ * This header does not depend on SCIP, so the kernels can be compared with the generic recurrence on their own.
+ */
+
+#ifndef __ROBUSTKERNEL_VRP_H__
+#define __ROBUSTKERNEL_VRP_H__
+
+#define ROBUST_KERNEL_MAXGAMMA      10          /* INT,        the robust arrival times are computed by a specialized function for up to this number of delays */
+
+/** branch free maximum of two integers */
+static inline
+int maxInt(
+    int a,
+    int b
+    )
+{
+    return a ^ ((a ^ b) & -(a < b));
+}
+
+/** Computes the robust arrival times at a customer from those at its predecessor, which is no depot.
+ *  The arrival time with gamma delays is the latest of the earliest service, no delay since the arrival with gamma
+ *  delays, one delay since the arrival with gamma - 1 delays and two delays since the arrival with gamma - 2 delays.
+ *  The times are updated in place from the largest gamma downwards, so each step reads the old values. If gammaMax is a
+ *  constant, the loop is unrolled completely. */
+static inline
+void robustTimesRecurrence(
+    int*        robustTimes,
+    int         gammaMax,
+    int         earliestService,
+    int         noDev,                  /**< service and travel time without delay */
+    int         singleDev,              /**< service and travel time with the larger one of both delayed */
+    int         doubleDev               /**< service and travel time with both delayed */
+    )
+{
+    int gamma;
+
+#pragma GCC unroll 16
+    for (gamma = gammaMax; gamma >= 2; gamma--)
+    {
+        robustTimes[gamma] = maxInt(maxInt(earliestService, noDev + robustTimes[gamma]),
+                                    maxInt(singleDev + robustTimes[gamma - 1], doubleDev + robustTimes[gamma - 2]));
+    }
+    if (gammaMax >= 1)
+    {
+        robustTimes[1] = maxInt(earliestService, maxInt(noDev + robustTimes[1], singleDev + robustTimes[0]));
+    }
+    robustTimes[0] = maxInt(earliestService, noDev + robustTimes[0]);
+}
+
+typedef void (*robust_times_kernel)(int*, int, int, int, int);
+
+/** defines the recurrence for a fixed number of delays */
+#define DEFINE_ROBUST_TIMES_KERNEL(G)                                                                                 \
+static inline void robustTimesKernel##G(int* robustTimes, int earliestService, int noDev, int singleDev,             \
+                                        int doubleDev)                                                                \
+{                                                                                                                     \
+    robustTimesRecurrence(robustTimes, G, earliestService, noDev, singleDev, doubleDev);                             \
+}
+
+DEFINE_ROBUST_TIMES_KERNEL(0)
+DEFINE_ROBUST_TIMES_KERNEL(1)
+DEFINE_ROBUST_TIMES_KERNEL(2)
+DEFINE_ROBUST_TIMES_KERNEL(3)
+DEFINE_ROBUST_TIMES_KERNEL(4)
+DEFINE_ROBUST_TIMES_KERNEL(5)
+DEFINE_ROBUST_TIMES_KERNEL(6)
+DEFINE_ROBUST_TIMES_KERNEL(7)
+DEFINE_ROBUST_TIMES_KERNEL(8)
+DEFINE_ROBUST_TIMES_KERNEL(9)
+DEFINE_ROBUST_TIMES_KERNEL(10)
+
+/** the recurrences for up to ROBUST_KERNEL_MAXGAMMA delays, indexed by the number of delays */
+static const robust_times_kernel robustTimesKernels[ROBUST_KERNEL_MAXGAMMA + 1] = {
+    robustTimesKernel0, robustTimesKernel1, robustTimesKernel2, robustTimesKernel3, robustTimesKernel4,
+    robustTimesKernel5, robustTimesKernel6, robustTimesKernel7, robustTimesKernel8, robustTimesKernel9,
+    robustTimesKernel10
+};
+
+#endif
@@ -0,0 +1,90 @@
+/**@file   stabilization_vrp.h
+ * @brief  Wentges smoothing of the dual values of reduced cost pricing
+ * @author Lukas Schürmann, University Bonn
+ *
+ * The exact labeling prices with a convex combination of a stability center and the dual values of the current LP,
+ * alpha * center + (1 - alpha) * duals, so the oscillation of the dual values of consecutive LPs is damped. The
+ * heuristic labeling runs before with the true dual values, because its columns are only useful if they have negative
+ * reduced costs in the current LP.
+ * The center is the dual vector with the best known Lagrangian bound at the current node, at first the true dual values
+ * of the first round. All rows of the master problem have right hand side 1 and every day has at most one tour, so the
+ * Lagrangian bound of the dual values of a round is at least their sum plus the smallest negative reduced costs of the
+ * tours of each day. The labeling reports them per day, also for the tours that are already contained in the master
+ * problem, and the dual values of every round whose bound is proven and better become the center.
+ * If a round with smoothed dual values finds no tour with negative reduced costs, this is a misprice. A round with
+ * smoothed dual values that adds no column is repeated with the true dual values, so the column generation only stops
+ * if there is no column with negative reduced costs.
+ */
+
+#ifndef __STABILIZATION_VRP_H__
+#define __STABILIZATION_VRP_H__
+
+#include "scip/scip.h"
+
+typedef struct _dual_stabilization
+{
+    double*         center;                 /**< nconss-array, stability center */
+    double*         duals;                  /**< nconss-array, dual values that are used in the current round */
+    int             nconss;                 /**< number of constraints */
+    double          alpha;                  /**< weight of the center in the smoothed dual values */
+    double          centerBound;            /**< Lagrangian bound of the center, -infinity if it is not known */
+    SCIP_Bool       hasCenter;              /**< FALSE until the first round at a node */
+    SCIP_Bool       isSmoothed;             /**< TRUE if the dual values of the current round are smoothed */
+    SCIP_Longint    nrounds;                /**< number of rounds of exact pricing */
+    SCIP_Longint    nsmoothed;              /**< number of rounds with smoothed dual values */
+    SCIP_Longint    nsmoothedSuccess;       /**< number of rounds in which the smoothed dual values gave new columns */
+    SCIP_Longint    nmisprices;             /**< number of rounds that were repeated with the true dual values */
+    SCIP_Longint    ncenterUpdates;         /**< number of rounds whose dual values became the center */
+} dual_stabilization;
+
+/** Creates the stabilization, the first round uses the true dual values */
+SCIP_RETCODE dualStabilizationCreate(
+    SCIP*           scip,
+    dual_stabilization** stabilization,
+    int             nconss,
+    double          alpha
+);
+
+/** Frees the stabilization */
+void dualStabilizationFree(
+    SCIP*           scip,
+    dual_stabilization** stabilization
+);
+
+/** Forgets the center, e.g. at a new node of the branching tree */
+void dualStabilizationReset(
+    dual_stabilization* stabilization
+);
+
+/**
+ * Starts a round of exact pricing, the dual values of the round are the dual values of the LP smoothed with the center
+ * @param duals dual values of the current LP, they are not changed */
+void dualStabilizationStartRound(
+    dual_stabilization* stabilization,
+    double*         duals
+);
+
+/**
+ * Finishes a round, its dual values become the center if their Lagrangian bound is proven and better. If no new column
+ * was found with smoothed dual values, they are replaced by the true ones.
+ * @param foundColumns TRUE if the round added columns
+ * @param minRedCosts nDays-array, smallest negative reduced costs of the tours of each day, 0 if there is none
+ * @param isProven nDays-array, TRUE if no tour of the day has smaller reduced costs
+ * @param duals dual values of the current LP
+ * @return TRUE if the round has to be repeated with the true dual values */
+SCIP_Bool dualStabilizationEndRound(
+    dual_stabilization* stabilization,
+    SCIP_Bool       foundColumns,
+    double*         minRedCosts,
+    SCIP_Bool*      isProven,
+    int             nDays,
+    double*         duals
+);
+
+/** Prints the number of rounds, misprices and updates of the center */
+void dualStabilizationPrintStatistics(
+    SCIP*           scip,
+    dual_stabilization* stabilization
+);
+
+#endif
@@ -0,0 +1,95 @@
+/**@file   threadmemory_vrp.h
+ * @brief  thread-local memory pools for the labels and the scratch memory of the labeling algorithm
+ * @author Lukas Schürmann, University Bonn
+ *
+ * Every thread that calls one of the functions gets its own pool on first use, so the labeling threads never share an
+ * allocator. Small blocks are rounded up to a power of two and are kept in a free list of their size class when they
+ * are freed, larger blocks are taken from the system directly. A block can be freed by another thread than the one
+ * that allocated it, it then goes to the free list of the freeing thread.
+ * The free lists of a thread hold at most THREAD_MEMORY_MAXCACHED bytes, further freed blocks are given back to the
+ * system, so the cached memory does not grow to the peak usage of every thread.
+ * The pools of all threads are kept until threadMemoryFreeAll() is called, which must happen when no thread uses them
+ * anymore.
+ */
+
+#ifndef __THREADMEMORY_VRP_H__
+#define __THREADMEMORY_VRP_H__
+
+#include <stddef.h>
+
+#include "scip/scip.h"
+
+#define THREAD_MEMORY_MINSIZE       16          /* INT,        size of the smallest size class in bytes, also the alignment of all blocks */
+#define THREAD_MEMORY_NCLASSES      13          /* INT,        number of size classes, larger blocks are taken from the system directly */
+#define THREAD_MEMORY_MAXCACHED     (16LL << 20) /* INT,       number of bytes that the free lists of one thread keep at most */
+
+typedef struct _thread_memory
+{
+    void*               freelists[THREAD_MEMORY_NCLASSES]; /**< freed blocks of each size class */
+    long long           nallocs;            /**< number of allocations of this thread */
+    long long           nfrees;             /**< number of blocks freed by this thread */
+    long long           nreused;            /**< number of allocations that were served by a free list */
+    long long           nbytesInUse;        /**< bytes allocated minus bytes freed by this thread, a block that is freed
+                                             *   by another thread is subtracted there */
+    long long           nbytesPeak;         /**< maximum of nbytesInUse */
+    long long           nbytesSystem;       /**< bytes taken from the system for the size classes */
+    long long           nbytesCached;       /**< bytes in the free lists of this thread */
+    long long           nreleased;          /**< number of freed blocks that were given back to the system, because the
+                                             *   free lists were full */
+    struct _thread_memory* next;            /**< pool of the next thread */
+} thread_memory;
+
+/** allocates memory for one element of the pointer type */
+#define threadAllocMemory(ptr)                  threadMemoryAlloc((void**) (ptr), sizeof(**(ptr)))
+
+/** allocates memory of the given size in bytes */
+#define threadAllocMemorySize(ptr, size)        threadMemoryAlloc((void**) (ptr), (size_t) (size))
+
+/** allocates memory for num elements of the pointer type */
+#define threadAllocMemoryArray(ptr, num)        threadMemoryAlloc((void**) (ptr), (size_t) (num) * sizeof(**(ptr)))
+
+/** allocates memory for num elements of the pointer type and sets it to zero */
+#define threadAllocClearMemoryArray(ptr, num)   threadMemoryAllocClear((void**) (ptr), (size_t) (num) * sizeof(**(ptr)))
+
+/** changes the size of an array, the content is kept */
+#define threadReallocMemoryArray(ptr, num)      threadMemoryRealloc((void**) (ptr), (size_t) (num) * sizeof(**(ptr)))
+
+/** frees memory and sets the pointer to NULL, nothing happens if it is NULL */
+#define threadFreeMemory(ptr)                   threadMemoryFree((void**) (ptr))
+#define threadFreeMemoryArray(ptr)              threadMemoryFree((void**) (ptr))
+#define threadFreeMemoryArrayNull(ptr)          threadMemoryFree((void**) (ptr))
+
+/** Allocates a block from the pool of the calling thread */
+SCIP_RETCODE threadMemoryAlloc(
+    void**              ptr,
+    size_t              size
+);
+
+/** Allocates a block from the pool of the calling thread and sets it to zero */
+SCIP_RETCODE threadMemoryAllocClear(
+    void**              ptr,
+    size_t              size
+);
+
+/** Changes the size of a block, the content is kept, a NULL block is allocated */
+SCIP_RETCODE threadMemoryRealloc(
+    void**              ptr,
+    size_t              size
+);
+
+/** Gives a block back to the pool of the calling thread and sets the pointer to NULL */
+void threadMemoryFree(
+    void**              ptr
+);
+
+/** Prints the statistics of the pools of all threads */
+void threadMemoryPrintStatistics(
+    SCIP*               scip
+);
+
+/** Frees the pools of all threads, no block must be in use anymore */
+void threadMemoryFreeAll(
+    void
+);
+
+#endif
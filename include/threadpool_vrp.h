@@ -0,0 +1,84 @@
+/**@file   threadpool_vrp.h
+ * @brief  long-lived pool of threads that run the tasks of the labeling algorithm
+ * @author Lukas Schürmann, University Bonn
+ *
+ * The pool is created together with the pricer and its threads wait for tasks until the pricer is freed. Tasks are
+ * submitted to a group and the submitting thread waits for all tasks of the group. While it waits, it runs queued
+ * tasks itself, so tasks can submit and wait for further tasks without blocking the pool.
+ */
+
+#ifndef __THREADPOOL_VRP_H__
+#define __THREADPOOL_VRP_H__
+
+#include <pthread.h>
+
+#include "scip/scip.h"
+
+/** function of a task, arg is the argument given to threadPoolSubmit() */
+typedef SCIP_RETCODE (*thread_task_func)(void* arg);
+
+/** tasks that are waited for together */
+typedef struct _thread_group
+{
+    int                 npending;           /**< number of submitted tasks that did not finish yet */
+    SCIP_RETCODE        retcode;            /**< first return code of a task that was not SCIP_OKAY */
+} thread_group;
+
+typedef struct _thread_task
+{
+    thread_task_func    func;               /**< function to be run */
+    void*               arg;                /**< argument of func */
+    thread_group*       group;              /**< group of the task */
+    struct _thread_task* next;              /**< next task of the queue */
+} thread_task;
+
+typedef struct _thread_pool
+{
+    pthread_t*          threads;            /**< threads of the pool */
+    int                 nthreads;           /**< number of threads */
+    thread_task*        first;              /**< first task of the queue */
+    thread_task*        last;               /**< last task of the queue */
+    pthread_mutex_t     mutex;              /**< protects the queue and the groups */
+    pthread_cond_t      taskAvailable;      /**< signaled if a task was queued or the pool shuts down */
+    pthread_cond_t      taskFinished;       /**< signaled if a task finished */
+    SCIP_Bool           isShutdown;         /**< TRUE if the threads have to stop */
+} thread_pool;
+
+/**
+ * Creates a pool and starts its threads
+ * @param nthreads number of threads, if it is not positive, the number of cores minus one is used, because the thread
+ *                 that waits for a group runs tasks as well */
+SCIP_RETCODE threadPoolCreate(
+    SCIP*               scip,
+    thread_pool**       pool,
+    int                 nthreads
+);
+
+/** Stops the threads of the pool and frees it, no tasks must be pending */
+SCIP_RETCODE threadPoolFree(
+    SCIP*               scip,
+    thread_pool**       pool
+);
+
+/** Initializes an empty group of tasks */
+void threadGroupInit(
+    thread_group*       group
+);
+
+/** Queues a task of the group */
+SCIP_RETCODE threadPoolSubmit(
+    thread_pool*        pool,
+    thread_group*       group,
+    thread_task_func    func,
+    void*               arg
+);
+
+/**
+ * Waits until all tasks of the group are finished and runs queued tasks in the meantime
+ * @return SCIP_OKAY or the first other return code of a task of the group */
+SCIP_RETCODE threadPoolWait(
+    thread_pool*        pool,
+    thread_group*       group
+);
+
+#endif
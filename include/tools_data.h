@@ -6,6 +6,7 @@
 #ifndef __TOOLS_DATA_H__
 #define __TOOLS_DATA_H__
 
+#include <limits.h>
 #include <scip/scip.h>
 
 #define REFDATE_DAY            1
@@ -13,6 +14,16 @@
 #define REFDATE_YEAR           2000
 #define REFDATE_WEEKDAY        5     /* <-> Saturday; we start counting weekdays at Monday <-> 0 */
 
+#define TRAVEL_MATRIX_ALIGNMENT 64    /* alignment of the rows of the travel time matrices in bytes */
+#define TRAVEL_SLICE_MAXTIME   USHRT_MAX /* largest travel time that can be stored in travel_slices */
+#define TRAVEL_SLICES          4     /* number of periods of a day with their own travel times (AM, noon, PM, evening) */
+
+/** number of ints of a row of a travel time matrix, the rows are padded to the alignment */
+#define travelMatrixRowSize(nC)      ( ((nC) + (int) (TRAVEL_MATRIX_ALIGNMENT / sizeof(int)) - 1) / (int) (TRAVEL_MATRIX_ALIGNMENT / sizeof(int)) * (int) (TRAVEL_MATRIX_ALIGNMENT / sizeof(int)) )
+
+/** number of ints of the block of a travel time matrix, including the space that is needed to align its start */
+#define travelMatrixBlockSize(nC)    ( (nC) * travelMatrixRowSize(nC) + (int) (TRAVEL_MATRIX_ALIGNMENT / sizeof(int)) - 1 )
+
 #define DEFAULT_SHIFT_START    21600 /* <-> 06:00; time in seconds when driver's daily work shift starts (hard lower bound for departure from depot) */
 #define DEFAULT_SHIFT_END      79200 /* <-> 22:00; time in seconds when driver's daily work shift ends   (hard upper bound for return to depot) */
 #define DEFAULT_BREAK_START    39600 /* <-> 11:00; time in seconds when the driver can start its break */
@@ -62,6 +73,32 @@ typedef struct _modelWindow
    struct _modelWindow*  next;                   /**< pointer to next timeWindow in list (or NULL) */
 }modelWindow;
 
+/** time windows of all customers and days in flat arrays, for every customer and day sorted by start time */
+typedef struct _windowTable
+{
+   int                   nDays;                  /**< number of days */
+   int*                  first;                  /**< (nC x nDays + 1)-array, the windows of customer i on day d are at positions first[i * nDays + d] to first[i * nDays + d + 1] - 1 */
+   int*                  start_t;                /**< array with the start of each window */
+   int*                  end_t;                  /**< array with the end of each window */
+   modelWindow**         windows;                /**< array with the list element of each window */
+   int                   nwindows;               /**< number of windows */
+}window_table;
+
+/** first position of the windows of customer node on a day in a window table */
+#define windowTableBegin(table, node, day)      ( (table)->first[(node) * (table)->nDays + (day)] )
+
+/** position after the last window of customer node on a day in a window table */
+#define windowTableEnd(table, node, day)        ( (table)->first[(node) * (table)->nDays + (day) + 1] )
+
+/** whether customer node has a window on a day in a window table */
+#define windowTableHasWindows(table, node, day) ( windowTableEnd(table, node, day) > windowTableBegin(table, node, day) )
+
+/** travel times of an arc in the periods of a day in 16 bits each */
+typedef struct _travelSlices
+{
+   unsigned short        travel[TRAVEL_SLICES];  /**< travel time in the morning, at noon, in the afternoon and in the evening (in seconds) */
+}travel_slices;
+
 /** list of neighbor nodes for each customer node and day of planning period */
 typedef struct _neighbor
 {
@@ -69,6 +106,27 @@ typedef struct _neighbor
    struct _neighbor*     next;                   /**< pointer to next neighbor in list (or NULL) */
 }neighbor;
 
+/** neighbor nodes of all customer nodes and days in flat arrays (offsets and heads of the arcs), in the order of the lists */
+typedef struct _neighborGraph
+{
+   int                   nC;                     /**< number of customers + 1 */
+   int                   nDays;                  /**< number of days */
+   int*                  first;                  /**< (nC x nDays + 1)-array, the neighbors of customer i on day d are at positions first[i * nDays + d] to first[i * nDays + d + 1] - 1 */
+   int*                  heads;                  /**< maxarcs-array with the neighbor of each arc */
+   int                   narcs;                  /**< number of arcs */
+   int                   maxarcs;                /**< size of heads */
+   int                   nstarted;               /**< number of entries of first that are set while the graph is built */
+}neighbor_graph;
+
+/** first position of the neighbors of customer node on a day in a neighbor graph */
+#define neighborGraphBegin(graph, node, day)    ( (graph)->first[(node) * (graph)->nDays + (day)] )
+
+/** position after the last neighbor of customer node on a day in a neighbor graph */
+#define neighborGraphEnd(graph, node, day)      ( (graph)->first[(node) * (graph)->nDays + (day) + 1] )
+
+/** neighbor at a position of a neighbor graph */
+#define neighborGraphHead(graph, pos)           ( (graph)->heads[pos] )
+
 typedef struct _solutionWindow
 {
     int                 day;                    /**< day (index w.r.t. planning period) */
@@ -148,6 +206,7 @@ typedef struct _modelData
    int                   nC;                     /**< number of customers + 1 (depot stored as last "customer") */
    int*                  customerIDs;            /**< nC-array with customer IDs (not needed for model, but kept for output/information purposes; depot gets ID -1) */
    modelWindow**         timeWindows;            /**< nC-array with linked list structures to store customers' delivery time windows */
+   window_table*         windowTable;            /**< the windows of timeWindows indexed by customer and day, built after the windows are complete */
    SCIP_Real*            obj;                    /**< nC-array with objective function coefficients for each customer */
    int                   shift_start;            /**< time when driver's daily work shift starts (no departure from depot before then) (in seconds) */
    int                   shift_end;              /**< time when driver's daily work shift ends (must return to depot by then) (in seconds) */
@@ -158,12 +217,16 @@ typedef struct _modelData
    int**                 t_travelPM;             /**< (nC x nC)-array with afternoon's travel times between customers in data set (in seconds) */
    int**                 t_travel;               /**< (nC x nC)-array with average travel times between customers in data set (in seconds) */
    int**                 t_travel_maxDev;        /**< (nC x nC)-array with estimated maximal deviation of travel times between customers beyond average (in seconds) */
+   travel_slices*        travelSlices;           /**< (nC x nC)-array (row-wise) with the travel times of the periods of a day, NULL if they are not built or a value does not fit */
+   int                   travelSegmentStart[2 * TRAVEL_SLICES - 1]; /**< start times of the periods and the transitions between them, the first one is 0 */
+   int                   travelTransition;       /**< length of the transitions between the periods (in seconds) */
    SCIP_Bool             workOnSaturdays;        /**< indicator whether saturdays are to be counted as workdays or not (TRUE/FALSE (1/0 unsigned int.)); for information/output purposes */
    date*                 startDate;              /**< struct containing the start date of the planning period (day, month, year, weekday); for information/output purposes */
    date*                 endDate;                /**< struct containing the end date of the planning period (day, month, year, weekday); for information/output purposes */
    int                   maxDelayEvents;         /**< maximal number of delay events (deviations in service and travel times combined) to be "robustified" against */
    int                   nDays;                  /**< number of work days in planning period (from startDate to endDate, including both) */
    neighbor***           neighbors;              /**< (nC x nDays) array of linked lists with neighbor nodes of customer nodes in total network (can be NULL <-> complete digraph) */
+   neighbor_graph*       neighborGraph;          /**< the lists of neighbors as flat arrays, NULL iff neighbors is NULL */
    dayProperty**         days;                   /**< struct containing the properties of each day */
    int*                  day_sizes;              /**< nDays-array with the number of available customers for each day */
    /* delivery dependencies (given customers must be serviced directly before or after current customer) -> ignored for now; precise meaning needs to be discussed further */
@@ -247,6 +310,78 @@ SCIP_RETCODE setModelTimeWindows(SCIP* scip, modelWindow** tw, int i, instance_d
 
 
 
+/** build the window table of the model data from its time window lists */
+extern
+SCIP_RETCODE createWindowTable(SCIP* scip, model_data* modelData);
+
+
+
+/** free the window table of the model data */
+extern
+void freeWindowTable(SCIP* scip, model_data* modelData);
+
+
+
+/** allocate a (nC x nC) travel time matrix, the rows are parts of one contiguous block and start at 64 byte boundaries */
+extern
+SCIP_RETCODE allocTravelMatrix(SCIP* scip, int*** matrix, int nC);
+
+
+
+/** free a travel time matrix that was allocated by allocTravelMatrix */
+extern
+void freeTravelMatrix(SCIP* scip, int*** matrix, int nC);
+
+
+
+/** build the travel times of the periods of a day for time dependent travel times from the AM, noon, PM and average matrices */
+extern
+SCIP_RETCODE createTravelSlices(SCIP* scip, model_data* modelData, const int* periodEnds, int minTransition);
+
+
+
+/** free the travel times of the periods of a day */
+extern
+void freeTravelSlices(SCIP* scip, model_data* modelData);
+
+
+
+/** create an empty neighbor graph with room for maxarcs arcs */
+extern
+SCIP_RETCODE createNeighborGraph(SCIP* scip, neighbor_graph** graph, int nC, int nDays, int maxarcs);
+
+
+
+/** free a neighbor graph */
+extern
+void freeNeighborGraph(SCIP* scip, neighbor_graph** graph);
+
+
+
+/** remove all arcs of a neighbor graph to build it again */
+extern
+void clearNeighborGraph(neighbor_graph* graph);
+
+
+
+/** append an arc to a neighbor graph that is built, the arcs have to be appended in increasing order of node and day */
+extern
+void addNeighborGraphArc(neighbor_graph* graph, int node, int day, int head);
+
+
+
+/** finish building a neighbor graph, all customers and days without appended arcs get no neighbors */
+extern
+void finishNeighborGraph(neighbor_graph* graph);
+
+
+
+/** build the neighbor graph of the model data from its neighbor lists */
+extern
+SCIP_RETCODE createModelNeighborGraph(SCIP* scip, model_data* modelData);
+
+
+
 /* increment the date in a date struct by a given number of days */
 extern
 SCIP_RETCODE incrementDate(date* d, int k);
@@ -18,14 +18,30 @@
 
 #define SAME_OBJECTIVES             TRUE        /* SCIP_BOOL,  if true, all customer dependent values for the objective function will be set to 1.0 */
 #define PARALLEL_LABELING           TRUE        /* SCIP_BOOL,  if true, the exact labeling algorithm will be executed in parallel with each day as a different thread */
+#define PARALLEL_HEURISTIC_LABELING TRUE        /* SCIP_BOOL,  if true, the heuristic labeling also runs the days in parallel, a customer that is visited by tours of several days is kept by the first day in the order of dual values */
 #define INFEASIBILITY_RECOVERY      FALSE       /* SCIP_BOOL,  if true, after detecting/estimating infeasibility, the same instance will be restarted with some customers as optional */
 #define HEURISTIC_DOMINANCE         FALSE        /* SCIP_BOOL,  if true, the dominance check will be performed as a heurisitic and ignores some conditions */
 #define HEURISTIC_COLLECTABLE       FALSE       /* SCIP_BOOL,  if true, the collectable reduced costs will be estimated in heuristic manner */
-#define TIME_DEPENDENT_TRAVEL_TIMES TRUE        /* SCIP_BOOL,  if true, the traveltime between two customers depends on the starttime at the first customer. */
+#define HEURISTIC_LABEL_ORDERING    TRUE        /* SCIP_BOOL,  if true, open labels are propagated by smallest reduced costs plus 0.1 * collectable reduced costs, else by smallest reduced costs */
+#define TIME_DEPENDENT_TRAVEL_TIMES FALSE       /* SCIP_BOOL,  if true, the traveltime between two customers depends on the starttime at the first customer, with linear transitions of TRAVEL_TIME_TRANSITION seconds between AM, noon, PM and evening */
+#define NG_ROUTE_RELAXATION         TRUE        /* SCIP_BOOL,  if true, exact labeling only remembers the visited customers of small ng-neighborhoods in the labels, tours with cycles are rejected and elementary labeling is the fallback */
+#define DSSR_LABELING               FALSE       /* SCIP_BOOL,  if true, exact labeling uses decremental state-space relaxation instead of ng-routes, labels only remember the visits of critical customers that were repeated in earlier rounds */
+#define COMPLETION_BOUNDS           TRUE        /* SCIP_BOOL,  if true, exact labeling prunes labels by precomputed lower bounds on the reduced costs to complete their tours */
+#define DUAL_STABILIZATION          TRUE        /* SCIP_BOOL,  if true, exact reduced cost pricing uses the dual values smoothed with those of the best known Lagrangian bound, a round without new columns is repeated with the true dual values */
+#define WARM_START_LABELING         TRUE        /* SCIP_BOOL,  if true, the paths of the best labels of the exact labeling of a day are kept and replayed with the new dual values as first open labels of the next round */
+
+#define LABEL_SELECTION             LABEL_SELECTION_RANDOM /* INT, order in which the customers of the open labels are propagated, see below */
+#define LABEL_SELECTION_SEED        0           /* INT,        seed of the random label selection, every labeling worker has its own generator, so the runs are reproducible */
 
 #define MIN_REQUIRED_LABELS         30          /* INT,        defines how many labels with negative reduced costs or positive farkas value must be generated before adding to master problem starts */         
 #define MAX_ADDED_LABELS            1           /* INT,        defines how many labels could be added to master problem in each iteration */
 #define MAX_CREATED_LABELS          1000        /* INT,        upper bound for the number of propagation steps before labeling is cancelled */
+#define LABELING_THREADS            0           /* INT,        number of threads of the pricing thread pool that runs the days and the intra-day workers of exact labeling, 0 uses the number of cores minus one */
+#define INTRA_DAY_THREADS           0           /* INT,        number of workers that share the exact labeling of one day, each one propagates the labels of a fixed share of the first customers of the tours, 0 splits the threads of the pool evenly over the days, 1 disables */
+#define NG_NEIGHBORHOOD_SIZE        30          /* INT,        number of nearest neighbors in the ng-neighborhood of each customer for the ng-route relaxation */
+#define DUAL_SMOOTHING_FACTOR       0.5         /* DOUBLE,     weight of the stability center in the smoothed dual values of dual stabilization, in [0,1) */
+#define WARM_START_LABELS           100         /* INT,        maximum number of labels of a day that are kept for the warm start of the next exact labeling */
+#define COMPLETION_BUCKET_SIZE      300         /* INT,        maximum length in seconds of the time buckets of the completion bounds */
 #define RELATIVE_GAP_LIMIT          0.00        /* DOUBLE,     solving stops if the relative gap is below this limit */
 #define LABELING_TIME_LIMIT         30          /* INT,        time limit in seconds, after which one exact pricing iteration stops */
 #define SOLVING_TIME_LIMIT          3600        /* INT,        time limit in seconds, after which scip stops */
@@ -38,8 +54,14 @@
 #define NOON_START                  39600       /* INT,        time when AM is over and noon starts */
 #define NOON_END                    54000       /* INT,        time when noon is over and PM starts */
 #define EVENING_START               64800       /* INT,        time when PM is over and evening starts */
+#define TRAVEL_TIME_TRANSITION      1800        /* INT,        minimal length in seconds of the transition between the travel times of two periods, it is extended if a travel time drops by more */
 #define WORKTIME_LIMIT              39600       /* INT,        maximum worktime in seconds (31680 sec = 8h 48 min = 8h + 10%, 39600 sec = 11h) */
 
+#define LABEL_SELECTION_RANDOM      0           /* the best open label of a random customer */
+#define LABEL_SELECTION_BEST        1           /* the open label with the smallest key of all customers */
+#define LABEL_SELECTION_TIME        2           /* of the best open labels of all customers, the one with the earliest arrival time */
+#define LABEL_SELECTION_LONGEST     3           /* of the best open labels of all customers, the one with the longest path */
+
 #define INT_BIT_SIZE                ( (int) sizeof(int) * 8 )
 #define SetBit(A,k)                 ( A[(k)/INT_BIT_SIZE] |= (1 << ((k)%INT_BIT_SIZE)) )
 #define ClearBit(A,k)               ( A[(k)/INT_BIT_SIZE] &= ~(1 << ((k)%INT_BIT_SIZE)) )
@@ -85,6 +107,28 @@ int getTravelTime(
     int             starttime
     );
 
+/**
+ * @param modeldata model data with all traveltimes
+ * @param start start node
+ * @param end end node
+ * @return maximal deviation of the travel time from start to end beyond average */
+int getTravelMaxDev(
+    model_data*     modeldata,
+    int             start,
+    int             end
+    );
+
+/**
+ * @param modeldata model data with all traveltimes
+ * @param start start node
+ * @param end end node
+ * @return smallest travel time of an arc over the whole day, a lower bound on getTravelTime() at any time */
+int getMinTravelTime(
+    model_data*     modeldata,
+    int             start,
+    int             end
+    );
+
 /**
  * Find maximum between two or more integer variables
  * @param args Total number of integers
@@ -0,0 +1,67 @@
+/**@file   warmstart_vrp.h
+ * @brief  paths of the best labels of the last exact labeling of each day, they seed the labeling of the next round
+ * @author Lukas Schürmann, University Bonn
+ *
+ * Only the sequences of customers are kept, the labels themselves are rebuilt by propagating the start label along
+ * the path with the dual values of the new round. A path that is not feasible anymore, e.g. because of a branching
+ * decision, is simply dropped by this replay.
+ * The paths of a day are only read and written by the labeling of this day, so the days can be labeled in parallel.
+ */
+
+#ifndef __WARMSTART_VRP_H__
+#define __WARMSTART_VRP_H__
+
+#include "scip/scip.h"
+#include "label_vrp.h"
+
+typedef struct _warm_start
+{
+    int**           paths;                  /**< nDays-array of (maxpaths x maxlength)-arrays, customers of the paths */
+    int**           lengths;                /**< nDays-array of maxpaths-arrays, number of customers of each path */
+    int*            npaths;                 /**< number of paths of each day */
+    int             nDays;                  /**< number of days */
+    int             maxpaths;               /**< maximum number of paths of a day */
+    int             maxlength;              /**< maximum number of customers of a path */
+} warm_start;
+
+/** returns the number of paths of a day */
+#define warmStartGetNPaths(warmstart, day)          ( (warmstart)->npaths[day] )
+
+/** returns the customers of path i of a day */
+#define warmStartGetPath(warmstart, day, i)         ( &(warmstart)->paths[day][(i) * (warmstart)->maxlength] )
+
+/** returns the number of customers of path i of a day */
+#define warmStartGetPathLength(warmstart, day, i)   ( (warmstart)->lengths[day][i] )
+
+/**
+ * Creates an empty warm start
+ * @param nDays number of days
+ * @param maxpaths maximum number of paths of a day
+ * @param maxlength maximum number of customers of a path, longer paths are not kept */
+SCIP_RETCODE warmStartCreate(
+    SCIP*           scip,
+    warm_start**    warmstart,
+    int             nDays,
+    int             maxpaths,
+    int             maxlength
+);
+
+/** Frees a warm start */
+void warmStartFree(
+    SCIP*           scip,
+    warm_start**    warmstart
+);
+
+/** Removes all paths of a day */
+void warmStartClear(
+    warm_start*     warmstart,
+    int             day
+);
+
+/** Adds the path of a label to the paths of its day, nothing happens if the day is full or the path too long */
+void warmStartAddLabel(
+    warm_start*     warmstart,
+    labelVrp*       label
+);
+
+#endif
@@ -506,6 +506,11 @@ SCIP_RETCODE runColumnGenerationModel(
    {
        modelData->maxDelayEvents = gamma;
    }
+   if(TIME_DEPENDENT_TRAVEL_TIMES)
+   {
+       int periodEnds[TRAVEL_SLICES - 1] = { NOON_START, NOON_END, EVENING_START };
+       SCIP_CALL( createTravelSlices(scip, modelData, periodEnds, TRAVEL_TIME_TRANSITION) );
+   }
    /*********************
     * Create Master Problem
     *********************/
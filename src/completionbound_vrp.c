@@ -0,0 +1,230 @@
+/**@file   completionbound_vrp.c
+ * @brief  lower bounds on the reduced costs to complete a tour, used to prune labels in exact pricing
+ * @author Lukas Schürmann, University Bonn
+ */
+
+#include <assert.h>
+#include <limits.h>
+
+#include "scip/scip.h"
+
+#include "completionbound_vrp.h"
+#include "threadmemory_vrp.h"
+#include "tools_vrp.h"
+#include "pricer_vrp.h"
+
+/**
+ * Local functions
+ */
+
+/** returns the smallest time between the arrival at a customer and the arrival at its next node on this day,
+ *  the buckets must not be longer so that every step of a tour ends in a later bucket */
+static
+int getMinStepTime(
+    model_data*     modeldata,
+    SCIP_Bool*      toDepot,
+    int             day
+    )
+{
+    neighbor_graph* graph = modeldata->neighborGraph;
+    int minStep = INT_MAX;
+    int i;
+    int k;
+
+    for (i = 0; i < modeldata->nC - 1; i++)
+    {
+        if (toDepot[i])
+        {
+            minStep = MIN(minStep, modeldata->t_service[i] + getMinTravelTime(modeldata, i, modeldata->nC - 1));
+        }
+        for (k = neighborGraphBegin(graph, i, day); k < neighborGraphEnd(graph, i, day); k++)
+        {
+            int j = neighborGraphHead(graph, k);
+            if (j == i || nodeIsDepot(modeldata, j))
+            {
+                continue;
+            }
+            minStep = MIN(minStep, modeldata->t_service[i] + getMinTravelTime(modeldata, i, j));
+        }
+    }
+    return minStep;
+}
+
+/** returns the reduced costs that are collected by visiting a customer, without the costs of the arc to it */
+static
+double getCustomerGain(
+    pricing_context* context,
+    int             node,
+    int             day
+    )
+{
+    double gain = context->dualvalues[node];
+
+    if (context->eC[node] == day)
+    {
+        gain += ENFORCED_PRICE_COLLECTING;
+    }
+    if (!context->isFarkas && context->useOptionals == TRUE && context->optionalCustomers[node] == TRUE)
+    {
+        gain += context->modeldata->obj[node] * PRICE_COLLECTING_WEIGHT;
+    }
+    return gain;
+}
+
+/**
+ * Interface functions
+ */
+
+/** Computes the completion bounds of a day for the dual values of the pricing context */
+extern
+SCIP_RETCODE completionBoundCreate(
+    SCIP*           scip,
+    pricing_context* context,
+    completion_bound** bound,
+    int             day
+    )
+{
+    model_data* modeldata = context->modeldata;
+    SCIP_Bool* toDepot = context->toDepot;
+    SCIP_Bool isFarkas = context->isFarkas;
+    completion_bound* cb;
+    neighbor_graph* graph = modeldata->neighborGraph;
+    double* gains;
+    int bucketsize;
+    int b;
+    int i;
+    int k;
+
+    assert(scip != NULL);
+    assert(modeldata != NULL);
+    assert(bound != NULL);
+    assert(toDepot != NULL);
+    assert(graph != NULL);
+
+    *bound = NULL;
+    bucketsize = MIN(COMPLETION_BUCKET_SIZE, getMinStepTime(modeldata, toDepot, day));
+    if (bucketsize <= 0)
+    {
+        return SCIP_OKAY;
+    }
+
+    SCIP_CALL( threadAllocMemory(&cb) );
+    cb->nC = modeldata->nC;
+    cb->bucketsize = bucketsize;
+    cb->start = modeldata->shift_start;
+    cb->nbuckets = (modeldata->shift_end - modeldata->shift_start) / bucketsize + 1;
+    SCIP_CALL( threadAllocMemoryArray(&cb->bounds, cb->nC * cb->nbuckets) );
+    for (i = 0; i < cb->nC * cb->nbuckets; i++)
+    {
+        cb->bounds[i] = SCIP_DEFAULT_INFINITY;
+    }
+
+    SCIP_CALL( threadAllocMemoryArray(&gains, modeldata->nC) );
+    for (i = 0; i < modeldata->nC - 1; i++)
+    {
+        gains[i] = getCustomerGain(context, i, day);
+    }
+
+    /* every step of a tour ends in a later bucket, so the buckets are computed from the end of the shift */
+    for (b = cb->nbuckets - 1; b >= 0; b--)
+    {
+        int arrival = cb->start + b * bucketsize;
+
+        for (i = 0; i < modeldata->nC - 1; i++)
+        {
+            double best = SCIP_DEFAULT_INFINITY;
+            int departure;
+
+            departure = arrival + modeldata->t_service[i];
+
+            /* return to the depot */
+            if (toDepot[i])
+            {
+                int traveltime = getTravelTime(modeldata, i, modeldata->nC - 1, departure);
+                if (departure + traveltime <= modeldata->shift_end)
+                {
+                    /* the travel costs of a tour are taken at other times, the smallest travel time keeps the bound valid */
+                    best = (isFarkas ? 0.0 : context->alphas[1] * getMinTravelTime(modeldata, i, modeldata->nC - 1));
+                }
+            }
+            /* continue at a neighbor */
+            for (k = neighborGraphBegin(graph, i, day); k < neighborGraphEnd(graph, i, day); k++)
+            {
+                modelWindow* window;
+                double next;
+                int traveltime;
+                int nextArrival;
+                int j = neighborGraphHead(graph, k);
+
+                if (j == i || nodeIsDepot(modeldata, j))
+                {
+                    continue;
+                }
+                traveltime = getTravelTime(modeldata, i, j, departure);
+                nextArrival = departure + traveltime;
+                window = getNextTimeWindow(modeldata, j, day, nextArrival);
+                if (window == NULL)
+                {
+                    continue;
+                }
+                nextArrival = MAX(nextArrival, window->start_t);
+                if (nextArrival > window->end_t || nextArrival > modeldata->shift_end)
+                {
+                    continue;
+                }
+                assert((nextArrival - cb->start) / bucketsize > b);
+                next = cb->bounds[j * cb->nbuckets + (nextArrival - cb->start) / bucketsize];
+                if (next >= SCIP_DEFAULT_INFINITY)
+                {
+                    continue;
+                }
+                next += (isFarkas ? 0.0 : context->alphas[1] * getMinTravelTime(modeldata, i, j)) - gains[j];
+                best = MIN(best, next);
+            }
+            cb->bounds[i * cb->nbuckets + b] = best;
+        }
+    }
+
+    threadFreeMemoryArray(&gains);
+    *bound = cb;
+
+    return SCIP_OKAY;
+}
+
+/** Frees the completion bounds */
+extern
+void completionBoundFree(
+    SCIP*           scip,
+    completion_bound** bound
+    )
+{
+    assert(bound != NULL);
+
+    if (*bound == NULL)
+    {
+        return;
+    }
+    threadFreeMemoryArray(&(*bound)->bounds);
+    threadFreeMemory(bound);
+}
+
+/** Returns a lower bound on the reduced costs to complete a tour from a customer */
+extern
+double completionBoundGet(
+    completion_bound* bound,
+    int             node,
+    int             arrivaltime
+    )
+{
+    int b;
+
+    assert(bound != NULL);
+    assert(0 <= node && node < bound->nC);
+
+    b = (arrivaltime - bound->start) / bound->bucketsize;
+    if (b >= bound->nbuckets)
+    {
+        return SCIP_DEFAULT_INFINITY;
+    }
+    return bound->bounds[node * bound->nbuckets + MAX(b, 0)];
+}
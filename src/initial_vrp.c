@@ -39,19 +39,23 @@ int getAvailableTimeOfCustomer(
         model_data*     modelData,
         int             node
 ){
-    modelWindow* timewindow;
+    window_table* table;
     int totaltime;
+    int day;
+    int i;
 
     assert(node >= 0 && node < modelData->nC-1);
 
-    timewindow = modelData->timeWindows[node];
-    assert(timewindow != NULL);
+    table = modelData->windowTable;
+    assert(table != NULL);
 
     totaltime = 0;
-    while (timewindow != NULL)
+    for (day = 0; day < modelData->nDays; day++)
     {
-        totaltime += (timewindow->end_t - timewindow->start_t);
-        timewindow = timewindow->next;
+        for (i = windowTableBegin(table, node, day); i < windowTableEnd(table, node, day); i++)
+        {
+            totaltime += (table->end_t[i] - table->start_t[i]);
+        }
     }
     return totaltime;
 }
@@ -118,6 +122,10 @@ SCIP_RETCODE addToursToModel(
                 if (tourlength[day] > 0)
                 {
                     SCIP_CALL(rearrangeTour(scip, modeldata, tours[day], tourlength[day], &tourobj[day], day));
+                    if (SCIPprobdataContainsTour(probdata, tours[day], tourlength[day], day))
+                    {
+                        continue;
+                    }
                     (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "%s_%2d: ", algoName, day);
                     for (i = 0; i < tourlength[day]; i++)
                     {
@@ -140,8 +148,8 @@ SCIP_RETCODE addToursToModel(
 
         for (day = 0; day < nDays; day++)
         {
-            /* create variables of feasible solution and add them to SCIP */
-            if (tourlength[day] > 0)
+            /* create variables of feasible solution and add them to SCIP, if they are not yet contained */
+            if (tourlength[day] > 0 && !SCIPprobdataContainsTour(probdata, tours[day], tourlength[day], day))
             {
                 (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "%s_%2d: ", algoName, day);
                 for (i = 0; i < tourlength[day]; i++)
@@ -206,7 +214,6 @@ SCIP_RETCODE getGreedyTour(
     int tourstart;
     SCIP_Bool isfeasible;
     modelWindow* timewindow;
-    neighbor* nb;
 
     SCIP_CALL( SCIPallocBlockMemoryArray(scip, &robusttimes, modeldata->maxDelayEvents + 1) );
     SCIP_CALL( SCIPallocBlockMemoryArray(scip, &returntimes, modeldata->maxDelayEvents + 1) );
@@ -223,14 +230,15 @@ SCIP_RETCODE getGreedyTour(
     while (TRUE) /* extend tour while there are still some reachable customers */
     {
         bestTime = modeldata->shift_end;
-        if(modeldata->neighbors != NULL){
-            nb = modeldata->neighbors[currentNode][day];
-            while (nb != NULL) /* iterate over the neighborhood of the head of the current tour */
+        if(modeldata->neighborGraph != NULL){
+            neighbor_graph* graph = modeldata->neighborGraph;
+            int k;
+            /* iterate over the neighborhood of the head of the current tour */
+            for (k = neighborGraphBegin(graph, currentNode, day); k < neighborGraphEnd(graph, currentNode, day); k++)
             {
-                i = nb->id;
+                i = neighborGraphHead(graph, k);
                 if (i == nC - 1 || dayofnode[i] >= 0) /* skip the depot and nodes that are already dayofnode by this or a tour of another day */
                 {
-                    nb = nb->next;
                     continue;
                 }
                 /* find the first time window of customer i that we can visit him in */
@@ -239,7 +247,6 @@ SCIP_RETCODE getGreedyTour(
                 timewindow = getNextTimeWindow(modeldata, i, day, arrivalTime);
                 if (timewindow == NULL) /* skip if there is none */
                 {
-                    nb = nb->next;
                     continue;
                 }
                 /* check at which time we would visit the customer if we got maximum delays (robustness)
@@ -248,7 +255,6 @@ SCIP_RETCODE getGreedyTour(
 
                 if (latestTime == -1) /* skip in the latter case */
                 {
-                    nb = nb->next;
                     continue;
                 }
                 /* Greedy: best neighbor = neighbor with earliest worst-case arrvial time */
@@ -265,7 +271,6 @@ SCIP_RETCODE getGreedyTour(
                     bestTime = latestTime;
                     tour[tourlength] = i;
                 }
-                nb = nb->next;
             }
         }else{
             for(i = 0; i < nC - 1; i++)
@@ -441,7 +446,6 @@ SCIP_RETCODE initialDispatching(
     int node, day, nC, nDays;
     int i, j, k;
     model_data* modelData;
-    modelWindow* timewindow;
     inttuple* sortedCustomers;                  // customers sorted by total length of their time windows
     inttuple** sortedDaysForCustomer;           // days sorted by flexibility - for each customer
     int* sizeofDays;                            // value[day]: (number of available customers) - (number of customers already used for different days)
@@ -492,15 +496,19 @@ SCIP_RETCODE initialDispatching(
     {
         node = sortedCustomers[i].index;    // current Customer
 
-        /* Set up priority array for node */
-        timewindow = modelData->timeWindows[node];
-        for(day = 0; day < nDaysOfCustomer[node]; day++)
+        /* Set up priority array for node, one entry for each day with a time window */
+        k = 0;
+        for(day = 0; day < nDays; day++)
         {
-            assert(timewindow != NULL);
-            sortedDaysForCustomer[node][day].value = sizeofDays[timewindow->day];
-            sortedDaysForCustomer[node][day].index = timewindow->day;
-            timewindow = timewindow->next;
+            if(!windowTableHasWindows(modelData->windowTable, node, day))
+            {
+                continue;
+            }
+            sortedDaysForCustomer[node][k].value = sizeofDays[day];
+            sortedDaysForCustomer[node][k].index = day;
+            k++;
         }
+        assert(k == nDaysOfCustomer[node]);
         qsort(sortedDaysForCustomer[node], nDaysOfCustomer[node], sizeof(sortedDaysForCustomer[node][0]), cmp_vrp);
 
         /* Search for a day which tour can be extended by node starting at the day with the least flexibility */
@@ -9,6 +9,7 @@
 #include "scip/scipdefplugins.h"
 
 #include "label_vrp.h"
+#include "threadmemory_vrp.h"
 #include "tools_data.h"
 #include "tools_vrp.h"
 #include "probdata_vrp.h"
@@ -18,6 +19,31 @@
  * Local functions
  */
 
+/** checks if node is on the path of label,
+ *  the bit array also contains unreachable customers, so only a set bit requires a look at the path */
+static
+SCIP_Bool labelVrpVisitsNode(
+    labelVrp*       label,
+    int             node
+    )
+{
+    assert(label != NULL);
+
+    if (!TestBit(label->bitVisitednodes, node))
+    {
+        return FALSE;
+    }
+    while (label != NULL && label->nvisitednodes > 0)
+    {
+        if (label->node == node)
+        {
+            return TRUE;
+        }
+        label = label->parent;
+    }
+    return FALSE;
+}
+
 static
 SCIP_Bool labelVrpIsFeasible(
     model_data*     modeldata,
@@ -25,20 +51,10 @@ SCIP_Bool labelVrpIsFeasible(
     )
 {
     modelWindow* timewindow;
-    int i;
 
     assert(modeldata != NULL);
     assert(label != NULL);
 
-    /* no customer should be visited twice */
-    for (i = 0; i < label->nvisitednodes - 1; i++)
-    {
-        if (label->visitednodes[i] == label->visitednodes[label->nvisitednodes - 1])
-        {
-            return FALSE;
-        }
-    }
-    
     /* the shift should not be already over */
     if (label->arrivaltimes[label->narrivaltimes - 1] > modeldata->shift_end)
     {
@@ -67,6 +83,50 @@ SCIP_Bool labelVrpIsFeasible(
     return TRUE;
 }
 
+/** returns the number of bytes a label with the given sizes takes in an arena */
+static
+size_t labelVrpBlockSize(
+    int             sizeBitarray,
+    int             narrivaltimes
+    )
+{
+    return labelArenaAlignedSize(sizeof(labelVrp)) + sizeof(int) * (size_t) (narrivaltimes + sizeBitarray);
+}
+
+/** allocates the memory of a label, in an arena the label and all of its arrays are one contiguous block */
+static
+SCIP_RETCODE labelVrpAlloc(
+    SCIP*           scip,
+    label_arena*    arena,
+    labelVrp**      label,
+    int             ncustomers,
+    int             narrivaltimes
+    )
+{
+    int sizeBitarray = ncustomers/INT_BIT_SIZE + 1;
+
+    assert(label != NULL);
+    assert(*label == NULL);
+
+    if (arena != NULL)
+    {
+        char* block;
+        SCIP_CALL( labelArenaAlloc(scip, arena, (void**) &block, labelVrpBlockSize(sizeBitarray, narrivaltimes)) );
+        *label = (labelVrp*) block;
+        (*label)->arrivaltimes = (int*) (block + labelArenaAlignedSize(sizeof(labelVrp)));
+        (*label)->bitVisitednodes = (*label)->arrivaltimes + narrivaltimes;
+    } else {
+        SCIP_CALL( threadAllocMemory(label) );
+        SCIP_CALL( threadAllocMemoryArray(&(*label)->arrivaltimes, narrivaltimes) );
+        SCIP_CALL( threadAllocMemoryArray(&(*label)->bitVisitednodes, sizeBitarray) );
+    }
+    (*label)->arena = arena;
+    (*label)->sizeBitarray = sizeBitarray;
+    (*label)->narrivaltimes = narrivaltimes;
+
+    return SCIP_OKAY;
+}
+
 
 /**
  * Interface functions
@@ -76,6 +136,7 @@ SCIP_Bool labelVrpIsFeasible(
 extern
 SCIP_RETCODE labelVrpCreateEmpty(
     SCIP*           scip, 
+    label_arena*    arena,
     labelVrp**      label,
     int             ncustomers,
     int             narrivaltimes,
@@ -92,18 +153,13 @@ SCIP_RETCODE labelVrpCreateEmpty(
     assert(ncustomers > 1);
     assert(narrivaltimes > 0);
 
-    SCIP_CALL( SCIPallocMemory(scip, label) );
-    SCIP_CALL( SCIPallocMemoryArray(scip, &(*label)->arrivaltimes, narrivaltimes));
-
-    (*label)->sizeBitarray = ncustomers/INT_BIT_SIZE + 1;
-    SCIP_CALL( SCIPallocMemoryArray(scip, &(*label)->bitVisitednodes, (*label)->sizeBitarray) );
+    SCIP_CALL( labelVrpAlloc(scip, arena, label, ncustomers, narrivaltimes) );
 
     (*label)->node = ncustomers - 1;
+    (*label)->parent = NULL;
+    (*label)->nvisitednodes = 0;
     (*label)->redcost = initialRedcost;
     (*label)->collactableRedcost = collactableRedcost;
-    (*label)->visitednodes = NULL;
-    (*label)->nvisitednodes = 0;
-    (*label)->narrivaltimes = narrivaltimes;
     (*label)->day = day;
     (*label)->starttime = 0;
     (*label)->ndominated = 0;
@@ -127,11 +183,11 @@ SCIP_RETCODE labelVrpCreateEmpty(
 extern
 SCIP_RETCODE labelVrpCreate(
     SCIP*           scip, 
+    label_arena*    arena,
     labelVrp**      label,
+    labelVrp*       parent,
     int             node,
     int             ncustomers,
-    int*            visitednodes,
-    int             nvisitednodes,
     int*            arrivaltimes,
     int             narrivaltimes,
     double          redcost,
@@ -151,15 +207,18 @@ SCIP_RETCODE labelVrpCreate(
     assert(arrivaltimes != NULL);
     assert(narrivaltimes > 0);
 
-    SCIP_CALL( labelVrpCreateEmpty(scip, label, ncustomers, narrivaltimes, redcost, collactableRedcost, day) );
-
-    SCIP_CALL( SCIPduplicateMemoryArray(scip, &(*label)->visitednodes, visitednodes, nvisitednodes) );
+    SCIP_CALL( labelVrpAlloc(scip, arena, label, ncustomers, narrivaltimes) );
 
     (*label)->node = node;
-    (*label)->nvisitednodes = nvisitednodes;
-    (*label)->narrivaltimes = narrivaltimes;
+    (*label)->parent = parent;
+    (*label)->nvisitednodes = (parent != NULL ? parent->nvisitednodes + 1 : 0);
+    (*label)->redcost = redcost;
+    (*label)->collactableRedcost = collactableRedcost;
     (*label)->day = day;
     (*label)->starttime = starttime;
+    (*label)->ndominated = 0;
+    (*label)->lhs = 0.0;
+    (*label)->nEC = nEC;
 
     for (i = 0; i < narrivaltimes; i++) 
     {
@@ -167,9 +226,13 @@ SCIP_RETCODE labelVrpCreate(
     }
 
     /* set bit array of visitednodes */
-    for (i = 0; i < nvisitednodes; i++)
+    for (i = 0; i < (*label)->sizeBitarray; i++)
+    {
+        (*label)->bitVisitednodes[i] = (parent != NULL ? parent->bitVisitednodes[i] : 0);
+    }
+    if (parent != NULL)
     {
-        SetBit((*label)->bitVisitednodes, (*label)->visitednodes[i]);
+        SetBit((*label)->bitVisitednodes, node);
     }
 
     return SCIP_OKAY;
@@ -186,13 +249,17 @@ SCIP_RETCODE labelVrpFree(
     assert(label != NULL);
     assert(*label != NULL);
 
-    if ((*label)->visitednodes != NULL)
+    /* labels of an arena are given back in bulk, only the last one can be reused directly */
+    if ((*label)->arena != NULL)
     {
-        SCIPfreeMemoryArray(scip, &(*label)->visitednodes);
+        labelArenaRelease((*label)->arena, *label, labelVrpBlockSize((*label)->sizeBitarray, (*label)->narrivaltimes));
+        *label = NULL;
+        return SCIP_OKAY;
     }
-    SCIPfreeMemoryArray(scip, &(*label)->arrivaltimes);
-    SCIPfreeMemoryArray(scip, &(*label)->bitVisitednodes);
-    SCIPfreeMemory(scip, label);
+
+    threadFreeMemoryArray(&(*label)->arrivaltimes);
+    threadFreeMemoryArray(&(*label)->bitVisitednodes);
+    threadFreeMemory(label);
 
     return SCIP_OKAY;
 }
@@ -201,18 +268,18 @@ SCIP_RETCODE labelVrpFree(
 extern
 SCIP_RETCODE labelVrpPropagate(
     SCIP*           scip,
-    SCIP_PRICERDATA* pricerdata,
-    model_data*     modeldata,
+    label_arena*    arena,
+    pricing_context* context,
     labelVrp*       oldLabel,
     labelVrp**      newLabel,
     int             end,
     double          dualvalue,
-    SCIP_Bool       isFarkas
+    int*            ngSet
     )
 {
+    model_data* modeldata = context->modeldata;
     /* potential new label variables */
-    int* visitednodes;
-    int nvisitednodes;
+    labelVrp* label = NULL;
     int* arrivaltimes;
     int narrivaltimes;
     double redcost;
@@ -224,7 +291,6 @@ SCIP_RETCODE labelVrpPropagate(
     SCIP_Bool isfeasible;
     double windowweight = 0.0;
     double lhs;
-    SCIP_PROBDATA* probdata = SCIPgetProbData(scip);
     SCIP_Bool isEnforced;
     int nEC;
 
@@ -236,31 +302,33 @@ SCIP_RETCODE labelVrpPropagate(
     assert(*newLabel == NULL);
     assert(0 <= end && end < modeldata->nC);
     assert(oldLabel->node != end);
-    assert(probdata != NULL);
 
-    /* new visited nodes */
-    nvisitednodes = oldLabel->nvisitednodes + 1;
-    SCIP_CALL( SCIPallocMemoryArray(scip, &visitednodes, nvisitednodes));
-    for (i = 0; i < oldLabel->nvisitednodes; i++) 
+    /* no customer should be visited twice, ng-route labels only check the customers they remember */
+    if (end != modeldata->nC - 1 && labelVrpVisitsNode(oldLabel, end))
     {
-        visitednodes[i] = oldLabel->visitednodes[i];
+        return SCIP_OKAY;
     }
-    visitednodes[nvisitednodes - 1] = end;
+
+    /* the new label is built in place, if it is rejected it is the last block of the arena and is reused directly */
+    narrivaltimes = oldLabel->narrivaltimes;
+    SCIP_CALL( labelVrpAlloc(scip, arena, &label, modeldata->nC, narrivaltimes) );
+    arrivaltimes = label->arrivaltimes;
 
     start = oldLabel->node;
     day = oldLabel->day;
-    isEnforced = pricerdata->eC[end] == day;
+    isEnforced = context->eC[end] == day;
     nEC = oldLabel->nEC;
-    narrivaltimes = oldLabel->narrivaltimes;
-    SCIP_CALL( SCIPduplicateMemoryArray(scip, &arrivaltimes, oldLabel->arrivaltimes,narrivaltimes) );
+    for (i = 0; i < narrivaltimes; i++)
+    {
+        arrivaltimes[i] = oldLabel->arrivaltimes[i];
+    }
 
     /* Calculate new arrival times */
     SCIP_CALL( updateRobustTimes(modeldata, arrivaltimes, start, end, day, &isfeasible, &windowweight, FALSE, NULL));
 
     if (!isfeasible && end != modeldata->nC - 1)
     {
-        SCIPfreeMemoryArray(scip, &visitednodes);
-        SCIPfreeMemoryArray(scip, &arrivaltimes);
+        SCIP_CALL( labelVrpFree(scip, &label) );
         return SCIP_OKAY;
     }
 
@@ -285,48 +353,61 @@ SCIP_RETCODE labelVrpPropagate(
     }
 
     /* if this is no farkas pricing, add the objective function to the red cost */
-    if (!isFarkas)
+    if (!context->isFarkas)
     {
-        assert(probdata != NULL);
-        redcost += probdata->alphas[1] * getTravelTime(modeldata, start, end, arrivaltimes[0])
-                +  probdata->alphas[2] * windowweight * WINDOW_WEIGHT_FACTOR;
+        redcost += context->alphas[1] * getTravelTime(modeldata, start, end, arrivaltimes[0])
+                +  context->alphas[2] * windowweight * WINDOW_WEIGHT_FACTOR;
         /* delay objective */
-        if (arrivaltimes[narrivaltimes - 1] - arrivaltimes[0] > probdata->delayTolerance)
+        if (arrivaltimes[narrivaltimes - 1] - arrivaltimes[0] > context->delayTolerance)
         {
-            redcost += probdata->alphas[0] * modeldata->obj[end] * (arrivaltimes[narrivaltimes - 1] - arrivaltimes[0] - probdata->delayTolerance);
+            redcost += context->alphas[0] * modeldata->obj[end] * (arrivaltimes[narrivaltimes - 1] - arrivaltimes[0] - context->delayTolerance);
         }
         /* Price Collecting for hard customers */
-        if (probdata->useOptionals == TRUE && probdata->optionalCustomers[end] == TRUE)
+        if (context->useOptionals == TRUE && context->optionalCustomers[end] == TRUE)
         {
-            redcost -= modeldata->obj[i] * PRICE_COLLECTING_WEIGHT;
+            redcost -= modeldata->obj[end] * PRICE_COLLECTING_WEIGHT;
         }
     }
 
     /* check if there are enough collectable dual values left to create a tour with negative reduced costs */
-    if (SCIPisSumNegative(scip, redcost + collactableRedcost) && !SCIPisSumPositive(scip, collactableRedcost))
+    if (contextIsSumNegative(context, redcost + collactableRedcost) && !contextIsSumPositive(context, collactableRedcost))
     {
-        /* create the new label */
-        SCIP_CALL( labelVrpCreate(scip, newLabel, end, modeldata->nC, visitednodes, nvisitednodes, arrivaltimes,
-                                  narrivaltimes, redcost, collactableRedcost, starttime, day, nEC) );
-
-        (*newLabel)->lhs = lhs;
-
-        for (i = 0; i < (*newLabel)->sizeBitarray; i++)
+        /* complete the new label, the visited nodes are only given by the reference to the old label */
+        label->node = end;
+        label->parent = oldLabel;
+        label->nvisitednodes = oldLabel->nvisitednodes + 1;
+        label->redcost = redcost;
+        label->collactableRedcost = collactableRedcost;
+        label->starttime = starttime;
+        label->day = day;
+        label->ndominated = 0;
+        label->lhs = lhs;
+        label->nEC = nEC;
+
+        /* an ng-route label only remembers the visited customers in the ng-neighborhood of end */
+        if (ngSet != NULL)
         {
-            (*newLabel)->bitVisitednodes[i] = oldLabel->bitVisitednodes[i];
+            for (i = 0; i < label->sizeBitarray; i++)
+            {
+                label->bitVisitednodes[i] = oldLabel->bitVisitednodes[i] & ngSet[i];
+            }
+        } else {
+            for (i = 0; i < label->sizeBitarray; i++)
+            {
+                label->bitVisitednodes[i] = oldLabel->bitVisitednodes[i];
+            }
         }
-        SetBit((*newLabel)->bitVisitednodes, end);
+        SetBit(label->bitVisitednodes, end);
         /* check if the newly created label is feasible */
-        if (!labelVrpIsFeasible(modeldata, *newLabel))
+        if (labelVrpIsFeasible(modeldata, label))
         {
-            labelVrpFree(scip, newLabel);
-            *newLabel = NULL;
+            *newLabel = label;
+            return SCIP_OKAY;
         }
     }
 
     /* free used memory */
-    SCIPfreeMemoryArray(scip, &visitednodes);
-    SCIPfreeMemoryArray(scip, &arrivaltimes);
+    SCIP_CALL( labelVrpFree(scip, &label) );
 
     return SCIP_OKAY;
 }
@@ -414,80 +495,83 @@ SCIP_Bool labelVrpDominates(
 
 /**
  * computes still collectable dualvalues for a given label
+ * @param context data of the pricing call with the dual values
  * @param label label with arivaltimes and current day
- * @param dualvalues dualvalues
  * @param upperTimeWindows nC-array with the last possible arrivaltime for each customer, 
  *                         this equals upper boundary of time window when customer has time window on this day
  *                         in all other cases the value is zero
+ * @param pathVisited bit array of the customers on the path of an ng-route label, NULL if the bit array of the label
+ *                    contains all of them
  * @return negative sum over all reduced cost that still could be collected for this label*/
 double labelVrpCollactableRedCostTimeDependent(
-    SCIP*           scip,
-    model_data*     modeldata,
+    pricing_context* context,
     labelVrp*       label,
-    double*         dualvalues,
-    int*            upperTimeWindows
+    int*            upperTimeWindows,
+    int*            pathVisited
     )
 {
-    SCIP_PROBDATA* probdata = SCIPgetProbData(scip);
+    model_data* modeldata = context->modeldata;
+    double* dualvalues = context->dualvalues;
     double possibleDualvalue = 0.0;
-    assert(scip != NULL);
     assert(modeldata != NULL);
     assert(label != NULL);
     assert(dualvalues != NULL);
     assert(upperTimeWindows != NULL);
 
-    if (modeldata->neighbors != NULL)
+    if (modeldata->neighborGraph != NULL)
     {
-        neighbor* node = modeldata->neighbors[modeldata->nC - 1][label->day];
-        assert(node != NULL);
-        while (node != NULL)
+        neighbor_graph* graph = modeldata->neighborGraph;
+        int depot = modeldata->nC - 1;
+        int k;
+        assert(neighborGraphEnd(graph, depot, label->day) > neighborGraphBegin(graph, depot, label->day));
+        for (k = neighborGraphBegin(graph, depot, label->day); k < neighborGraphEnd(graph, depot, label->day); k++)
         {
-            if (node->id == modeldata->nC - 1)
+            int next = neighborGraphHead(graph, k);
+            if (next == depot)
             {
-                node = node->next;
                 continue;
             }
-            if (!TestBit(label->bitVisitednodes, node->id))
+            /* the dual values of customers on the path are not collected again by an elementary tour */
+            if (!TestBit(label->bitVisitednodes, next) && (pathVisited == NULL || !TestBit(pathVisited, next)))
             {
-                if (label->arrivaltimes[label->narrivaltimes - 1] + getTravelTime(modeldata, label->node, node->id, label->arrivaltimes[label->narrivaltimes - 1]) + modeldata->t_service[label->node] < upperTimeWindows[node->id])
+                if (label->arrivaltimes[label->narrivaltimes - 1] + getMinTravelTime(modeldata, label->node, next) + modeldata->t_service[label->node] < upperTimeWindows[next])
                 {
-                    double serviceThreshold = probdata->alphas[1] * probdata->shortestEdge[label->day][node->id];
+                    double serviceThreshold = context->alphas[1] * context->shortestEdge[label->day][next];
                     /* Price Collecting for hard customers */
                     double hardCustomerBonus = 0;
-                    if (probdata->useOptionals == TRUE && probdata->optionalCustomers[node->id] == TRUE)
+                    if (context->useOptionals == TRUE && context->optionalCustomers[next] == TRUE)
                     {
-                        hardCustomerBonus = modeldata->obj[node->id] * PRICE_COLLECTING_WEIGHT;
+                        hardCustomerBonus = modeldata->obj[next] * PRICE_COLLECTING_WEIGHT;
                     }
                     /* if the current time is after the beginning of all time windows, there can't be any more resets of delay, so the current delay will be also present in all future nodes */
                     if (label->arrivaltimes[0] >= upperTimeWindows[modeldata->nC - 1] || HEURISTIC_COLLECTABLE)
                     {
-                        double delayThreshold = probdata->alphas[0] * modeldata->obj[node->id] * (label->arrivaltimes[label->narrivaltimes - 1] - label->arrivaltimes[0] - probdata->delayTolerance);
-                        if (SCIPisSumPositive(scip, dualvalues[node->id] + hardCustomerBonus - serviceThreshold - delayThreshold))
+                        double delayThreshold = context->alphas[0] * modeldata->obj[next] * (label->arrivaltimes[label->narrivaltimes - 1] - label->arrivaltimes[0] - context->delayTolerance);
+                        if (contextIsSumPositive(context, dualvalues[next] + hardCustomerBonus - serviceThreshold - delayThreshold))
                         {
-                            possibleDualvalue -= dualvalues[node->id] + hardCustomerBonus - serviceThreshold - delayThreshold;
+                            possibleDualvalue -= dualvalues[next] + hardCustomerBonus - serviceThreshold - delayThreshold;
                         }
                     } else {
-                        if (SCIPisSumPositive(scip, dualvalues[node->id] + hardCustomerBonus - serviceThreshold))
+                        if (contextIsSumPositive(context, dualvalues[next] + hardCustomerBonus - serviceThreshold))
                         {
-                            possibleDualvalue -= dualvalues[node->id] + hardCustomerBonus - serviceThreshold;
+                            possibleDualvalue -= dualvalues[next] + hardCustomerBonus - serviceThreshold;
                         }
                     }
                 } else {
-                    SetBit(label->bitVisitednodes, node->id);
+                    SetBit(label->bitVisitednodes, next);
                 }
             }
-            node = node->next;
         }
     /* if the instance is not preprocessed */
     } else {
         int i;
         for (i = 0; i < modeldata->nC - 1; i++)
         {
-            if (!TestBit(label->bitVisitednodes, i)
-                && SCIPisSumPositive(scip, dualvalues[i] - probdata->alphas[1] * probdata->shortestEdge[label->day][i])
+            if (!TestBit(label->bitVisitednodes, i) && (pathVisited == NULL || !TestBit(pathVisited, i))
+                && contextIsSumPositive(context, dualvalues[i] - context->alphas[1] * context->shortestEdge[label->day][i])
                 && label->arrivaltimes[label->narrivaltimes - 1] < upperTimeWindows[i])
             {
-                possibleDualvalue -= dualvalues[i] - probdata->alphas[1] * probdata->shortestEdge[label->day][i];
+                possibleDualvalue -= dualvalues[i] - context->alphas[1] * context->shortestEdge[label->day][i];
             }
         }
     }
@@ -495,6 +579,122 @@ double labelVrpCollactableRedCostTimeDependent(
     return possibleDualvalue;
 }
 
+/** Writes the bit array of the customers on the path of a label */
+extern
+void labelVrpGetPathVisited(
+    labelVrp*       label,
+    int*            pathVisited
+    )
+{
+    int i;
+
+    assert(label != NULL);
+    assert(pathVisited != NULL);
+
+    for (i = 0; i < label->sizeBitarray; i++)
+    {
+        pathVisited[i] = 0;
+    }
+    for (; label != NULL && label->nvisitednodes > 0; label = label->parent)
+    {
+        SetBit(pathVisited, label->node);
+    }
+}
+
+/** Checks if no customer is visited twice on the path of a label */
+extern
+SCIP_Bool labelVrpIsElementary(
+    labelVrp*       label
+    )
+{
+    labelVrp* other;
+
+    assert(label != NULL);
+
+    for (; label != NULL && label->nvisitednodes > 0; label = label->parent)
+    {
+        for (other = label->parent; other != NULL && other->nvisitednodes > 0; other = other->parent)
+        {
+            if (other->node == label->node)
+            {
+                return FALSE;
+            }
+        }
+    }
+    return TRUE;
+}
+
+/** Sets the bits of all customers that are visited more than once on the path of a label */
+extern
+void labelVrpAddRepeatedNodes(
+    labelVrp*       label,
+    int*            repeatedNodes
+    )
+{
+    labelVrp* other;
+
+    assert(label != NULL);
+    assert(repeatedNodes != NULL);
+
+    for (; label != NULL && label->nvisitednodes > 0; label = label->parent)
+    {
+        for (other = label->parent; other != NULL && other->nvisitednodes > 0; other = other->parent)
+        {
+            if (other->node == label->node)
+            {
+                SetBit(repeatedNodes, label->node);
+                break;
+            }
+        }
+    }
+}
+
+/** Writes the sequence of visited nodes of a label */
+extern
+void labelVrpGetPath(
+    labelVrp*       label,
+    int*            path
+    )
+{
+    int i;
+
+    assert(label != NULL);
+    assert(path != NULL);
+
+    for (i = label->nvisitednodes - 1; i >= 0; i--)
+    {
+        assert(label != NULL);
+        path[i] = label->node;
+        label = label->parent;
+    }
+}
+
+/** prints the visited nodes of a label recursively, starting at the depot */
+static
+void printPathRecursive(
+    labelVrp*       label
+    )
+{
+    if (label == NULL || label->nvisitednodes == 0)
+    {
+        return;
+    }
+    printPathRecursive(label->parent);
+    printf("%d->", label->node);
+}
+
+/** Print the visited nodes of a label */
+extern
+void labelVrpPrintPath(
+    labelVrp*       label
+    )
+{
+    assert(label != NULL);
+
+    printPathRecursive(label);
+    printf("\n");
+}
+
 /** Print label data */
 extern
 void labelVrpPrint(
@@ -516,11 +716,7 @@ void labelVrpPrint(
     assert(label->nvisitednodes >= 0);
     assert(label->narrivaltimes >= 0);
 
-    for (i = 0; i < label->nvisitednodes; i++) {
-        printf("%d-> ", label->visitednodes[i]);
-        assert(0 <= label->visitednodes[i] );
-    }
-    printf("\n");
+    labelVrpPrintPath(label);
 
     for (i = 0; i < label->narrivaltimes; i++) {
         printf("%d, ", label->arrivaltimes[i]);
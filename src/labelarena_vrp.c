@@ -0,0 +1,203 @@
+/**@file   labelarena_vrp.c
+ * @brief  bump allocator for labels and labellists of one labeling run
+ * @author Lukas Schürmann, University Bonn
+ */
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "labelarena_vrp.h"
+#include "threadmemory_vrp.h"
+
+/** returns the first usable byte of a chunk */
+#define chunkData(chunk)            ( (char*) (chunk) + sizeof(label_arena_chunk) )
+
+/** allocates a new chunk with at least the given capacity */
+static
+SCIP_RETCODE chunkCreate(
+    SCIP*               scip,
+    label_arena_chunk** chunk,
+    size_t              capacity
+    )
+{
+    assert(chunk != NULL);
+
+    SCIP_CALL( threadAllocMemorySize(chunk, sizeof(label_arena_chunk) + capacity) );
+    (*chunk)->next = NULL;
+    (*chunk)->capacity = capacity;
+    (*chunk)->used = 0;
+
+    return SCIP_OKAY;
+}
+
+/** Creates an empty arena, chunks are allocated on demand */
+SCIP_RETCODE labelArenaCreate(
+    SCIP*               scip,
+    label_arena**       arena,
+    size_t              chunksize
+    )
+{
+    assert(scip != NULL);
+    assert(arena != NULL);
+    assert(chunksize > 0);
+
+    SCIP_CALL( threadAllocMemory(arena) );
+    (*arena)->chunks = NULL;
+    (*arena)->current = NULL;
+    (*arena)->chunksize = labelArenaAlignedSize(chunksize);
+    (*arena)->children = NULL;
+    (*arena)->nchildren = 0;
+
+    return SCIP_OKAY;
+}
+
+/** Frees the arena and all of its chunks */
+SCIP_RETCODE labelArenaFree(
+    SCIP*               scip,
+    label_arena**       arena
+    )
+{
+    label_arena_chunk* chunk;
+    int i;
+
+    assert(scip != NULL);
+    assert(arena != NULL);
+    assert(*arena != NULL);
+
+    for (i = 0; i < (*arena)->nchildren; i++)
+    {
+        SCIP_CALL( labelArenaFree(scip, &(*arena)->children[i]) );
+    }
+    threadFreeMemoryArrayNull(&(*arena)->children);
+
+    chunk = (*arena)->chunks;
+    while (chunk != NULL)
+    {
+        label_arena_chunk* next = chunk->next;
+        threadFreeMemory(&chunk);
+        chunk = next;
+    }
+    threadFreeMemory(arena);
+
+    return SCIP_OKAY;
+}
+
+/** Hands out a block of the given size */
+SCIP_RETCODE labelArenaAlloc(
+    SCIP*               scip,
+    label_arena*        arena,
+    void**              block,
+    size_t              size
+    )
+{
+    label_arena_chunk* chunk;
+
+    assert(arena != NULL);
+    assert(block != NULL);
+
+    size = labelArenaAlignedSize(size);
+    chunk = arena->current;
+
+    /* go to the next chunk with enough space left, chunks of earlier runs are reused */
+    while (chunk != NULL && chunk->used + size > chunk->capacity)
+    {
+        chunk = chunk->next;
+        if (chunk != NULL)
+        {
+            chunk->used = 0;
+        }
+    }
+
+    /* all chunks are full, append a new one */
+    if (chunk == NULL)
+    {
+        SCIP_CALL( chunkCreate(scip, &chunk, MAX(size, arena->chunksize)) );
+        if (arena->current == NULL)
+        {
+            assert(arena->chunks == NULL);
+            arena->chunks = chunk;
+        }
+        else
+        {
+            /* the new chunk is inserted directly after the current one, so that no chunk is skipped on reuse */
+            chunk->next = arena->current->next;
+            arena->current->next = chunk;
+        }
+    }
+    arena->current = chunk;
+
+    *block = chunkData(chunk) + chunk->used;
+    chunk->used += size;
+
+    return SCIP_OKAY;
+}
+
+/** Gives a block back to the arena */
+void labelArenaRelease(
+    label_arena*        arena,
+    void*               block,
+    size_t              size
+    )
+{
+    assert(arena != NULL);
+    assert(block != NULL);
+
+    size = labelArenaAlignedSize(size);
+
+    /* only the block on top of the current chunk can be reused */
+    if (arena->current == NULL || (char*) block + size != chunkData(arena->current) + arena->current->used)
+    {
+        return;
+    }
+    assert((char*) block >= chunkData(arena->current));
+
+    arena->current->used -= size;
+}
+
+/** Releases all blocks at once, also the ones of the child arenas, the chunks are kept for the next labeling run */
+void labelArenaReset(
+    label_arena*        arena
+    )
+{
+    int i;
+
+    assert(arena != NULL);
+
+    arena->current = arena->chunks;
+    if (arena->current != NULL)
+    {
+        arena->current->used = 0;
+    }
+    for (i = 0; i < arena->nchildren; i++)
+    {
+        labelArenaReset(arena->children[i]);
+    }
+}
+
+/** Returns a child arena, which is created on demand */
+SCIP_RETCODE labelArenaGetChild(
+    SCIP*               scip,
+    label_arena*        arena,
+    int                 i,
+    label_arena**       child
+    )
+{
+    assert(arena != NULL);
+    assert(child != NULL);
+    assert(i >= 0);
+
+    if (i >= arena->nchildren)
+    {
+        int k;
+
+        SCIP_CALL( threadReallocMemoryArray(&arena->children, i + 1) );
+        for (k = arena->nchildren; k <= i; k++)
+        {
+            SCIP_CALL( labelArenaCreate(scip, &arena->children[k], arena->chunksize) );
+        }
+        arena->nchildren = i + 1;
+    }
+    *child = arena->children[i];
+
+    return SCIP_OKAY;
+}
@@ -0,0 +1,236 @@
+/**@file   labelheap_vrp.c
+ * @brief  binary heap of labellists, ordered by their value
+ * @author Lukas Schürmann, University Bonn
+ */
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "labelheap_vrp.h"
+#include "threadmemory_vrp.h"
+
+/** returns TRUE if list a has to be extracted before list b */
+#define isBefore(a, b)              ( (a)->value < (b)->value || ((a)->value == (b)->value && (a)->order > (b)->order) )
+
+/** sets a labellist to a position of the heap */
+static
+void heapSet(
+    label_heap*     heap,
+    int             pos,
+    label_list*     list
+    )
+{
+    heap->entries[pos] = list;
+    list->heappos = pos;
+}
+
+/** moves the labellist at pos upwards until the heap order is restored */
+static
+void siftUp(
+    label_heap*     heap,
+    int             pos
+    )
+{
+    label_list* list = heap->entries[pos];
+
+    while (pos > 0)
+    {
+        int parent = (pos - 1) / 2;
+        if (!isBefore(list, heap->entries[parent]))
+        {
+            break;
+        }
+        heapSet(heap, pos, heap->entries[parent]);
+        pos = parent;
+    }
+    heapSet(heap, pos, list);
+}
+
+/** moves the labellist at pos downwards until the heap order is restored */
+static
+void siftDown(
+    label_heap*     heap,
+    int             pos
+    )
+{
+    label_list* list = heap->entries[pos];
+
+    for (;;)
+    {
+        int child = 2 * pos + 1;
+        if (child >= heap->nentries)
+        {
+            break;
+        }
+        if (child + 1 < heap->nentries && isBefore(heap->entries[child + 1], heap->entries[child]))
+        {
+            child++;
+        }
+        if (!isBefore(heap->entries[child], list))
+        {
+            break;
+        }
+        heapSet(heap, pos, heap->entries[child]);
+        pos = child;
+    }
+    heapSet(heap, pos, list);
+}
+
+/** Initializes an empty heap */
+void labelHeapInit(
+    label_heap*     heap
+    )
+{
+    assert(heap != NULL);
+
+    heap->entries = NULL;
+    heap->nentries = 0;
+    heap->size = 0;
+    heap->ninserted = 0;
+}
+
+/** Creates an empty heap */
+SCIP_RETCODE labelHeapCreate(
+    SCIP*           scip,
+    label_heap**    heap
+    )
+{
+    assert(scip != NULL);
+    assert(heap != NULL);
+
+    SCIP_CALL( threadAllocMemory(heap) );
+    labelHeapInit(*heap);
+
+    return SCIP_OKAY;
+}
+
+/** Frees the memory of a heap that was initialized by labelHeapInit() */
+void labelHeapExit(
+    SCIP*           scip,
+    label_heap*     heap
+    )
+{
+    assert(heap != NULL);
+
+    if (heap->entries != NULL)
+    {
+        threadFreeMemoryArray(&heap->entries);
+    }
+    heap->nentries = 0;
+    heap->size = 0;
+}
+
+/** Frees a heap that was created by labelHeapCreate() */
+SCIP_RETCODE labelHeapFree(
+    SCIP*           scip,
+    label_heap**    heap
+    )
+{
+    assert(scip != NULL);
+    assert(heap != NULL);
+    assert(*heap != NULL);
+
+    labelHeapExit(scip, *heap);
+    threadFreeMemory(heap);
+
+    return SCIP_OKAY;
+}
+
+/** Removes all labellists from the heap */
+void labelHeapClear(
+    label_heap*     heap
+    )
+{
+    int i;
+
+    assert(heap != NULL);
+
+    for (i = 0; i < heap->nentries; i++)
+    {
+        heap->entries[i]->heappos = -1;
+    }
+    heap->nentries = 0;
+}
+
+/** Inserts a labellist with the key list->value */
+SCIP_RETCODE labelHeapInsert(
+    SCIP*           scip,
+    label_heap*     heap,
+    label_list*     list
+    )
+{
+    assert(heap != NULL);
+    assert(list != NULL);
+    assert(list->heappos == -1);
+
+    if (heap->nentries == heap->size)
+    {
+        heap->size = MAX(16, 2 * heap->size);
+        if (heap->entries == NULL)
+        {
+            SCIP_CALL( threadAllocMemoryArray(&heap->entries, heap->size) );
+        } else {
+            SCIP_CALL( threadReallocMemoryArray(&heap->entries, heap->size) );
+        }
+    }
+    list->order = heap->ninserted;
+    heap->ninserted++;
+    heap->entries[heap->nentries] = list;
+    heap->nentries++;
+    siftUp(heap, heap->nentries - 1);
+
+    return SCIP_OKAY;
+}
+
+/** Removes and returns the labellist with the smallest value */
+label_list* labelHeapExtractMin(
+    label_heap*     heap
+    )
+{
+    label_list* list;
+
+    assert(heap != NULL);
+
+    if (heap->nentries == 0)
+    {
+        return NULL;
+    }
+    list = heap->entries[0];
+    labelHeapRemove(heap, list);
+
+    return list;
+}
+
+/** Removes a labellist from the heap */
+void labelHeapRemove(
+    label_heap*     heap,
+    label_list*     list
+    )
+{
+    int pos;
+
+    assert(heap != NULL);
+    assert(list != NULL);
+
+    pos = list->heappos;
+    if (pos < 0)
+    {
+        return;
+    }
+    assert(heap->entries[pos] == list);
+
+    list->heappos = -1;
+    heap->nentries--;
+    if (pos == heap->nentries)
+    {
+        return;
+    }
+    /* the last labellist fills the gap and is moved to its correct position */
+    heapSet(heap, pos, heap->entries[heap->nentries]);
+    if (pos > 0 && isBefore(heap->entries[pos], heap->entries[(pos - 1) / 2]))
+    {
+        siftUp(heap, pos);
+    } else {
+        siftDown(heap, pos);
+    }
+}
@@ -0,0 +1,448 @@
+/**@file   labelindex_vrp.c
+ * @brief  per-node index of labels for the dominance check
+ * @author Lukas Schürmann, University Bonn
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "scip/scip.h"
+#include "labelindex_vrp.h"
+#include "threadmemory_vrp.h"
+#include "tools_vrp.h"
+
+/** returns word w of a visited bit array of ints as 64 bit word */
+static
+uint64_t getVisitedWord(
+    int*            bitarray,
+    int             sizeBitarray,
+    int             w
+    )
+{
+    uint64_t word = (uint32_t) bitarray[2 * w];
+    if (2 * w + 1 < sizeBitarray)
+    {
+        word |= ((uint64_t) (uint32_t) bitarray[2 * w + 1]) << 32;
+    }
+    return word;
+}
+
+/** frees the arrays of a bucket */
+static
+void bucketFree(
+    SCIP*           scip,
+    label_bucket*   bucket
+    )
+{
+    if (bucket->entries == NULL)
+    {
+        return;
+    }
+    threadFreeMemoryArray(&bucket->entries);
+    threadFreeMemoryArray(&bucket->redcost);
+    threadFreeMemoryArray(&bucket->nvisitednodes);
+    threadFreeMemoryArray(&bucket->starttime);
+    threadFreeMemoryArray(&bucket->arrivaltimes);
+    threadFreeMemoryArray(&bucket->visited);
+}
+
+/** enlarges the arrays of a bucket, the column wise stored values are moved to their new positions */
+static
+SCIP_RETCODE bucketGrow(
+    SCIP*           scip,
+    label_index*    index,
+    label_bucket*   bucket
+    )
+{
+    int* arrivaltimes;
+    uint64_t* visited;
+    int newsize;
+    int i;
+
+    newsize = MAX(LABEL_INDEX_BLOCKSIZE, 2 * bucket->size);
+    assert(newsize % LABEL_INDEX_BLOCKSIZE == 0);
+
+    if (bucket->entries == NULL)
+    {
+        SCIP_CALL( threadAllocMemoryArray(&bucket->entries, newsize) );
+        SCIP_CALL( threadAllocMemoryArray(&bucket->redcost, newsize) );
+        SCIP_CALL( threadAllocMemoryArray(&bucket->nvisitednodes, newsize) );
+        SCIP_CALL( threadAllocMemoryArray(&bucket->starttime, newsize) );
+    } else {
+        SCIP_CALL( threadReallocMemoryArray(&bucket->entries, newsize) );
+        SCIP_CALL( threadReallocMemoryArray(&bucket->redcost, newsize) );
+        SCIP_CALL( threadReallocMemoryArray(&bucket->nvisitednodes, newsize) );
+        SCIP_CALL( threadReallocMemoryArray(&bucket->starttime, newsize) );
+    }
+
+    /* unused positions are compared in full blocks, so they have to be initialized */
+    SCIP_CALL( threadAllocClearMemoryArray(&arrivaltimes, newsize * index->narrivaltimes) );
+    SCIP_CALL( threadAllocClearMemoryArray(&visited, newsize * index->nwords) );
+    for (i = bucket->size; i < newsize; i++)
+    {
+        bucket->redcost[i] = 0.0;
+        bucket->nvisitednodes[i] = 0;
+        bucket->starttime[i] = 0;
+    }
+    if (bucket->size > 0)
+    {
+        for (i = 0; i < index->narrivaltimes; i++)
+        {
+            memcpy(&arrivaltimes[i * newsize], &bucket->arrivaltimes[i * bucket->size], sizeof(int) * (size_t) bucket->size);
+        }
+        for (i = 0; i < index->nwords; i++)
+        {
+            memcpy(&visited[i * newsize], &bucket->visited[i * bucket->size], sizeof(uint64_t) * (size_t) bucket->size);
+        }
+        threadFreeMemoryArray(&bucket->arrivaltimes);
+        threadFreeMemoryArray(&bucket->visited);
+    }
+    bucket->arrivaltimes = arrivaltimes;
+    bucket->visited = visited;
+    bucket->size = newsize;
+
+    return SCIP_OKAY;
+}
+
+/** Creates an empty index */
+SCIP_RETCODE labelIndexCreate(
+    SCIP*           scip,
+    label_index**   index,
+    int             nnodes,
+    int             narrivaltimes,
+    int             sizeBitarray,
+    int             starttime,
+    int             endtime
+    )
+{
+    int i;
+
+    assert(scip != NULL);
+    assert(index != NULL);
+    assert(nnodes > 0);
+    assert(narrivaltimes > 0);
+    assert(sizeBitarray > 0);
+
+    SCIP_CALL( threadAllocMemory(index) );
+    (*index)->nnodes = nnodes;
+    (*index)->nbuckets = LABEL_INDEX_NBUCKETS;
+    (*index)->starttime = starttime;
+    (*index)->bucketwidth = MAX(1, (endtime - starttime) / LABEL_INDEX_NBUCKETS + 1);
+    (*index)->narrivaltimes = narrivaltimes;
+    (*index)->nwords = (sizeBitarray + 1) / 2;
+    (*index)->sumepsilon = SCIPsumepsilon(scip);
+    (*index)->ncompared = 0;
+    (*index)->nskipped = 0;
+
+    SCIP_CALL( threadAllocMemoryArray(&(*index)->probeArrivaltimes, narrivaltimes) );
+    SCIP_CALL( threadAllocMemoryArray(&(*index)->probeDifferences, narrivaltimes) );
+    SCIP_CALL( threadAllocMemoryArray(&(*index)->probeVisited, (*index)->nwords) );
+
+    SCIP_CALL( threadAllocMemoryArray(&(*index)->buckets, nnodes * LABEL_INDEX_NBUCKETS) );
+    for (i = 0; i < nnodes * LABEL_INDEX_NBUCKETS; i++)
+    {
+        (*index)->buckets[i].entries = NULL;
+        (*index)->buckets[i].nentries = 0;
+        (*index)->buckets[i].size = 0;
+        (*index)->buckets[i].minRedcost = SCIP_DEFAULT_INFINITY;
+        (*index)->buckets[i].maxRedcost = -SCIP_DEFAULT_INFINITY;
+    }
+
+    return SCIP_OKAY;
+}
+
+/** Frees the index, the labels are not touched */
+SCIP_RETCODE labelIndexFree(
+    SCIP*           scip,
+    label_index**   index
+    )
+{
+    int i;
+
+    assert(scip != NULL);
+    assert(index != NULL);
+    assert(*index != NULL);
+
+    for (i = 0; i < (*index)->nnodes * (*index)->nbuckets; i++)
+    {
+        bucketFree(scip, &(*index)->buckets[i]);
+    }
+    threadFreeMemoryArray(&(*index)->buckets);
+    threadFreeMemoryArray(&(*index)->probeArrivaltimes);
+    threadFreeMemoryArray(&(*index)->probeDifferences);
+    threadFreeMemoryArray(&(*index)->probeVisited);
+    threadFreeMemory(index);
+
+    return SCIP_OKAY;
+}
+
+/** Adds the label of a labellist to the index */
+SCIP_RETCODE labelIndexInsert(
+    SCIP*           scip,
+    label_index*    index,
+    label_list*     list
+    )
+{
+    label_bucket* bucket;
+    labelVrp* label;
+    int pos;
+    int i;
+
+    assert(index != NULL);
+    assert(list != NULL);
+    assert(list->bucket == NULL);
+
+    label = list->label;
+    assert(0 <= label->node && label->node < index->nnodes);
+    assert(label->narrivaltimes == index->narrivaltimes);
+    bucket = labelIndexGetBucket(index, label->node, label->arrivaltimes[0]);
+
+    if (bucket->nentries == bucket->size)
+    {
+        SCIP_CALL( bucketGrow(scip, index, bucket) );
+    }
+    pos = bucket->nentries;
+    bucket->entries[pos] = list;
+    bucket->redcost[pos] = label->redcost;
+    bucket->nvisitednodes[pos] = label->nvisitednodes;
+    bucket->starttime[pos] = label->starttime;
+    for (i = 0; i < index->narrivaltimes; i++)
+    {
+        bucket->arrivaltimes[i * bucket->size + pos] = label->arrivaltimes[i];
+    }
+    for (i = 0; i < index->nwords; i++)
+    {
+        bucket->visited[i * bucket->size + pos] = getVisitedWord(label->bitVisitednodes, label->sizeBitarray, i);
+    }
+    list->bucket = bucket;
+    list->bucketpos = pos;
+    bucket->nentries++;
+
+    /* the bounds are only widened, after removals they are still valid but maybe not tight */
+    if (label->redcost < bucket->minRedcost)
+    {
+        bucket->minRedcost = label->redcost;
+    }
+    if (label->redcost > bucket->maxRedcost)
+    {
+        bucket->maxRedcost = label->redcost;
+    }
+
+    return SCIP_OKAY;
+}
+
+/** Removes the label of a labellist from the index */
+void labelIndexRemove(
+    label_index*    index,
+    label_list*     list
+    )
+{
+    label_bucket* bucket;
+    int last;
+    int pos;
+    int i;
+
+    assert(index != NULL);
+    assert(list != NULL);
+
+    bucket = list->bucket;
+    if (bucket == NULL)
+    {
+        return;
+    }
+    pos = list->bucketpos;
+    assert(bucket->entries[pos] == list);
+
+    /* move the last entry into the gap */
+    bucket->nentries--;
+    last = bucket->nentries;
+    bucket->entries[pos] = bucket->entries[last];
+    bucket->entries[pos]->bucketpos = pos;
+    bucket->redcost[pos] = bucket->redcost[last];
+    bucket->nvisitednodes[pos] = bucket->nvisitednodes[last];
+    bucket->starttime[pos] = bucket->starttime[last];
+    for (i = 0; i < index->narrivaltimes; i++)
+    {
+        bucket->arrivaltimes[i * bucket->size + pos] = bucket->arrivaltimes[i * bucket->size + last];
+    }
+    for (i = 0; i < index->nwords; i++)
+    {
+        bucket->visited[i * bucket->size + pos] = bucket->visited[i * bucket->size + last];
+    }
+    list->bucket = NULL;
+    list->bucketpos = -1;
+
+    if (bucket->nentries == 0)
+    {
+        bucket->minRedcost = SCIP_DEFAULT_INFINITY;
+        bucket->maxRedcost = -SCIP_DEFAULT_INFINITY;
+    }
+}
+
+/** Sets the label that is compared to the labels of the index by the following calls */
+void labelIndexSetProbe(
+    label_index*    index,
+    labelVrp*       label
+    )
+{
+    int i;
+
+    assert(index != NULL);
+    assert(label != NULL);
+    assert(label->narrivaltimes == index->narrivaltimes);
+
+    index->probeRedcost = label->redcost;
+    index->probeNvisitednodes = label->nvisitednodes;
+    index->probeStarttime = label->starttime;
+    for (i = 0; i < index->narrivaltimes; i++)
+    {
+        index->probeArrivaltimes[i] = label->arrivaltimes[i];
+    }
+    for (i = 0; i < index->narrivaltimes - 1; i++)
+    {
+        index->probeDifferences[i] = label->arrivaltimes[i + 1] - label->arrivaltimes[i];
+    }
+    for (i = 0; i < index->nwords; i++)
+    {
+        index->probeVisited[i] = getVisitedWord(label->bitVisitednodes, label->sizeBitarray, i);
+    }
+}
+
+/** computes for a block of the bucket, which labels dominate the probe label, see labelVrpDominates() */
+static
+void blockDominatesProbe(
+    label_index*    index,
+    label_bucket*   bucket,
+    int             blockstart,
+    int*            result
+    )
+{
+    const int size = bucket->size;
+    int i;
+    int j;
+
+    for (j = 0; j < LABEL_INDEX_BLOCKSIZE; j++)
+    {
+        result[j] = (blockstart + j < bucket->nentries)
+                  & (bucket->redcost[blockstart + j] - index->probeRedcost <= index->sumepsilon)
+                  & (bucket->nvisitednodes[blockstart + j] <= index->probeNvisitednodes)
+                  & (bucket->starttime[blockstart + j] >= index->probeStarttime);
+    }
+    for (i = 0; i < index->narrivaltimes; i++)
+    {
+        const int* column = &bucket->arrivaltimes[i * size + blockstart];
+        const int probe = index->probeArrivaltimes[i];
+        for (j = 0; j < LABEL_INDEX_BLOCKSIZE; j++)
+        {
+            result[j] &= (column[j] <= probe);
+        }
+    }
+    if (!HEURISTIC_DOMINANCE)
+    {
+        for (i = 0; i < index->nwords; i++)
+        {
+            const uint64_t* column = &bucket->visited[i * size + blockstart];
+            const uint64_t probe = ~index->probeVisited[i];
+            for (j = 0; j < LABEL_INDEX_BLOCKSIZE; j++)
+            {
+                result[j] &= ((column[j] & probe) == 0);
+            }
+        }
+        for (i = 0; i < index->narrivaltimes - 1; i++)
+        {
+            const int* column = &bucket->arrivaltimes[i * size + blockstart];
+            const int* nextColumn = &bucket->arrivaltimes[(i + 1) * size + blockstart];
+            const int probe = index->probeDifferences[i];
+            for (j = 0; j < LABEL_INDEX_BLOCKSIZE; j++)
+            {
+                result[j] &= (nextColumn[j] - column[j] <= probe);
+            }
+        }
+    }
+}
+
+/** Searches a label in a bucket that dominates the probe label */
+int labelIndexFindDominating(
+    label_index*    index,
+    label_bucket*   bucket
+    )
+{
+    int result[LABEL_INDEX_BLOCKSIZE];
+    int blockstart;
+    int j;
+
+    assert(index != NULL);
+    assert(bucket != NULL);
+
+    for (blockstart = 0; blockstart < bucket->nentries; blockstart += LABEL_INDEX_BLOCKSIZE)
+    {
+        blockDominatesProbe(index, bucket, blockstart, result);
+        index->ncompared += MIN(LABEL_INDEX_BLOCKSIZE, bucket->nentries - blockstart);
+        for (j = 0; j < LABEL_INDEX_BLOCKSIZE; j++)
+        {
+            if (result[j])
+            {
+                return blockstart + j;
+            }
+        }
+    }
+    return -1;
+}
+
+/** Checks which labels of a block of a bucket are dominated by the probe label */
+void labelIndexGetDominated(
+    label_index*    index,
+    label_bucket*   bucket,
+    int             blockstart,
+    int*            isDominated
+    )
+{
+    const int size = bucket->size;
+    int i;
+    int j;
+
+    assert(index != NULL);
+    assert(bucket != NULL);
+    assert(blockstart % LABEL_INDEX_BLOCKSIZE == 0);
+    assert(blockstart < bucket->size);
+
+    index->ncompared += MIN(LABEL_INDEX_BLOCKSIZE, bucket->nentries - blockstart);
+    for (j = 0; j < LABEL_INDEX_BLOCKSIZE; j++)
+    {
+        isDominated[j] = (blockstart + j < bucket->nentries)
+                       & (index->probeRedcost - bucket->redcost[blockstart + j] <= index->sumepsilon)
+                       & (index->probeNvisitednodes <= bucket->nvisitednodes[blockstart + j])
+                       & (index->probeStarttime >= bucket->starttime[blockstart + j]);
+    }
+    for (i = 0; i < index->narrivaltimes; i++)
+    {
+        const int* column = &bucket->arrivaltimes[i * size + blockstart];
+        const int probe = index->probeArrivaltimes[i];
+        for (j = 0; j < LABEL_INDEX_BLOCKSIZE; j++)
+        {
+            isDominated[j] &= (probe <= column[j]);
+        }
+    }
+    if (!HEURISTIC_DOMINANCE)
+    {
+        for (i = 0; i < index->nwords; i++)
+        {
+            const uint64_t* column = &bucket->visited[i * size + blockstart];
+            const uint64_t probe = index->probeVisited[i];
+            for (j = 0; j < LABEL_INDEX_BLOCKSIZE; j++)
+            {
+                isDominated[j] &= ((probe & ~column[j]) == 0);
+            }
+        }
+        for (i = 0; i < index->narrivaltimes - 1; i++)
+        {
+            const int* column = &bucket->arrivaltimes[i * size + blockstart];
+            const int* nextColumn = &bucket->arrivaltimes[(i + 1) * size + blockstart];
+            const int probe = index->probeDifferences[i];
+            for (j = 0; j < LABEL_INDEX_BLOCKSIZE; j++)
+            {
+                isDominated[j] &= (probe <= nextColumn[j] - column[j]);
+            }
+        }
+    }
+}
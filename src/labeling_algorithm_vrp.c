@@ -7,6 +7,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <time.h>
+#include <stdatomic.h>
 #include <pthread.h>
 
 #include "tools_data.h"
@@ -15,80 +16,305 @@
 #include "vardata_vrp.h"
 #include "label_vrp.h"
 #include "labellist_vrp.h"
+#include "labelarena_vrp.h"
+#include "labelindex_vrp.h"
+#include "labelheap_vrp.h"
+#include "completionbound_vrp.h"
+#include "threadpool_vrp.h"
+#include "pricingcontext_vrp.h"
+#include "threadmemory_vrp.h"
+#include "warmstart_vrp.h"
 #include "tools_vrp.h"
 #include "labeling_algorithm_vrp.h"
 #include "cons_arcflow.h"
 
-/** returns accumulated lengths of labellists */
+/** returns accumulated sizes of the heaps of open labels */
 static
-int labellistsTotalLength(
-        label_list **labellists,
-        int nlists
+int labelheapsTotalLength(
+        label_heap *openlabels,
+        int nheaps
 ) {
     int i;
     int length = 0;
-    assert(labellists != NULL);
-    for (i = 0; i < nlists; i++) {
-        length += labellistLength(labellists[i]);
+    assert(openlabels != NULL);
+    for (i = 0; i < nheaps; i++) {
+        length += openlabels[i].nentries;
     }
     return length;
 }
 
-/** Randomly chooses the next customer for propagation */
+/** returns the first state of the random generator of a labeling worker, it is never 0 */
+static
+unsigned int getRandomSeed(
+        int day,
+        int worker
+) {
+    unsigned int seed = (unsigned int) LABEL_SELECTION_SEED * 2654435761u + (unsigned int) day * 40503u
+                        + (unsigned int) worker * 9973u;
+    return (seed == 0 ? 1 : seed);
+}
+
+/** returns the next number of a xorshift generator, each worker has its own state */
+static
+unsigned int getRandomNumber(
+        unsigned int *state
+) {
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/** returns the key of the best open label of a customer in the order of LABEL_SELECTION, smaller keys come first */
+static
+double getSelectionKey(
+        label_list *list
+) {
+    switch (LABEL_SELECTION) {
+        case LABEL_SELECTION_TIME:
+            return list->label->arrivaltimes[0];
+        case LABEL_SELECTION_LONGEST:
+            return -list->label->nvisitednodes;
+        default:
+            return list->value;
+    }
+}
+
+/** Chooses the next customer for propagation by LABEL_SELECTION and extracts its best open label */
 static
 SCIP_RETCODE getNextList(
         SCIP *scip,
-        label_list **labellists,
+        label_heap *openlabels,
         label_list **list,
-        int nlists
+        int nheaps,
+        unsigned int *randomState
 ) {
-    int randIndex = rand() % nlists;
+    int index;
     int i;
 
-    assert(labellists != NULL);
+    assert(openlabels != NULL);
     assert(*list == NULL);
-    assert(nlists > 0);
-
-    /* search for the next list after randIndex, that is not empty */
-    for (i = 0; i < nlists; i++) {
-        if (labellists[randIndex] != NULL) {
-            *list = labellists[randIndex];
-            labellists[randIndex] = (*list)->next;
-            if ((*list)->next != NULL) {
-                (*list)->next->prev = NULL;
+    assert(nheaps > 0);
+
+    if (LABEL_SELECTION == LABEL_SELECTION_RANDOM) {
+        /* search for the next heap after a random one, that is not empty */
+        index = (int) (getRandomNumber(randomState) % (unsigned int) nheaps);
+        for (i = 0; i < nheaps; i++) {
+            if (openlabels[index].nentries > 0) {
+                *list = labelHeapExtractMin(&openlabels[index]);
+                break;
             }
-            break;
+            index = (index + 1) % nheaps;
+        }
+        return SCIP_OKAY;
+    }
+
+    /* compare the best open labels of all customers, ties are broken by the smaller customer */
+    index = -1;
+    for (i = 0; i < nheaps; i++) {
+        if (openlabels[i].nentries > 0 && (index < 0 || getSelectionKey(openlabels[i].entries[0])
+                                                        < getSelectionKey(openlabels[index].entries[0]))) {
+            index = i;
         }
-        randIndex = (randIndex + 1) % nlists;
+    }
+    if (index >= 0) {
+        *list = labelHeapExtractMin(&openlabels[index]);
     }
     return SCIP_OKAY;
 }
 
-/** Sorts the neighbors of each customer available on this day by dualvalues */
+/** returns the key of a label in the heap of open labels, smaller keys are propagated first */
+static
+double getOpenLabelValue(
+        labelVrp *label
+) {
+    /* heuristic ordering, results in modified depth search with less stagnation */
+    if (HEURISTIC_LABEL_ORDERING) {
+        return label->redcost + 0.1 * label->collactableRedcost;
+    }
+    return label->redcost;
+}
+
+/** neighbors of the customers of one day, computed once per day of a pricing call and shared by all labeling rounds
+ *  and workers of this day. The sequence of neighbors of a node is only sorted by dual values up to nsorted, the
+ *  prefix is extended by a partial selection when a label is propagated to more neighbors. Ties are broken by the
+ *  smaller customer, so the prefix does not depend on the order in which the workers extended it. */
+typedef struct _sorted_neighbors {
+    tuple **neighbors;                       /* neighbors of each node in the order of the graph, without the depot */
+    tuple **sorted;                          /* the same neighbors, the first nsorted ones are sorted by cmpNeighbors and
+                                              * no neighbor behind them has larger dual values */
+    int *nneighbors;
+    atomic_int *nsorted;
+    pthread_mutex_t mutex;                   /* locked while a sorted prefix is extended */
+} sorted_neighbors;
+
+/** Collects the neighbors of each customer available on this day with their dualvalues, the depot is left out.
+ *  None of them is sorted yet. */
 static
-SCIP_RETCODE getNeighborsSorted(
+SCIP_RETCODE createSortedNeighbors(
         SCIP *scip,
-        model_data *modeldata,
-        tuple **permutedNeighbors,
-        int *npermutedNeighbors,
-        double *dualvalues,
-        int day
+        pricing_context *context,
+        int day,
+        sorted_neighbors **neighbors
 ) {
+    model_data *modeldata = context->modeldata;
+    neighbor_graph *graph = context->neighborGraph;
+    sorted_neighbors *sn;
     int i;
-    assert(permutedNeighbors != NULL);
-    assert(npermutedNeighbors != NULL);
-    assert(dualvalues != NULL);
-    for (i = 0; i < modeldata->nC; i++) {
-        npermutedNeighbors[i] = getNumberOfNeighbors(scip, modeldata, i, day);
-        SCIP_CALL(SCIPallocMemoryArray(scip, &(permutedNeighbors[i]), npermutedNeighbors[i]));
+    int k;
+    assert(neighbors != NULL);
+    assert(graph != NULL);
 
-        SCIP_CALL(
-                sortNeighborsOfNode(scip, modeldata, day, i, permutedNeighbors[i], npermutedNeighbors[i], dualvalues));
+    SCIP_CALL(threadAllocMemory(neighbors));
+    sn = *neighbors;
+    SCIP_CALL(threadAllocMemoryArray(&sn->neighbors, modeldata->nC));
+    SCIP_CALL(threadAllocMemoryArray(&sn->sorted, modeldata->nC));
+    SCIP_CALL(threadAllocMemoryArray(&sn->nneighbors, modeldata->nC));
+    SCIP_CALL(threadAllocMemoryArray(&sn->nsorted, modeldata->nC));
+    pthread_mutex_init(&sn->mutex, NULL);
+    for (i = 0; i < modeldata->nC; i++) {
+        int begin = neighborGraphBegin(graph, i, day);
+        int end = neighborGraphEnd(graph, i, day);
+        SCIP_CALL(threadAllocMemoryArray(&(sn->neighbors[i]), MAX(1, end - begin)));
+        SCIP_CALL(threadAllocMemoryArray(&(sn->sorted[i]), MAX(1, end - begin)));
+        sn->nneighbors[i] = 0;
+        atomic_init(&sn->nsorted[i], 0);
+        for (k = begin; k < end; k++) {
+            int head = neighborGraphHead(graph, k);
+            if (!nodeIsDepot(modeldata, head)) {
+                sn->neighbors[i][sn->nneighbors[i]].index = head;
+                sn->neighbors[i][sn->nneighbors[i]].value = context->dualvalues[head];
+                sn->nneighbors[i]++;
+            }
+        }
+        memcpy(sn->sorted[i], sn->neighbors[i], sn->nneighbors[i] * sizeof(sn->neighbors[i][0]));
     }
 
     return SCIP_OKAY;
 }
 
+/** Frees the neighbors of a day */
+static
+void freeSortedNeighbors(
+        SCIP *scip,
+        int nC,
+        sorted_neighbors **neighbors
+) {
+    int i;
+    assert(neighbors != NULL);
+    assert(*neighbors != NULL);
+
+    for (i = 0; i < nC; i++) {
+        threadFreeMemoryArray(&((*neighbors)->sorted[i]));
+        threadFreeMemoryArray(&((*neighbors)->neighbors[i]));
+    }
+    pthread_mutex_destroy(&(*neighbors)->mutex);
+    threadFreeMemoryArray(&(*neighbors)->nsorted);
+    threadFreeMemoryArray(&(*neighbors)->nneighbors);
+    threadFreeMemoryArray(&(*neighbors)->sorted);
+    threadFreeMemoryArray(&(*neighbors)->neighbors);
+    threadFreeMemory(neighbors);
+}
+
+/** returns TRUE if neighbor a comes before neighbor b, by larger dual values and then by the smaller customer */
+static inline
+SCIP_Bool isBetterNeighbor(
+        const tuple *a,
+        const tuple *b
+) {
+    return a->value > b->value || (a->value == b->value && a->index < b->index);
+}
+
+/** compare function for qsort, sorts neighbors in the order of isBetterNeighbor() */
+static
+int cmpNeighbors(
+        const void *a,
+        const void *b
+) {
+    if (isBetterNeighbor(a, b)) {
+        return -1;
+    }
+    return (isBetterNeighbor(b, a) ? 1 : 0);
+}
+
+/** moves the k neighbors with the largest dual values to the front of the array in no particular order (quickselect) */
+static
+void selectNeighbors(
+        tuple *neighbors,
+        int nneighbors,
+        int k
+) {
+    int left = 0;
+    int right = nneighbors - 1;
+    assert(0 < k && k <= nneighbors);
+
+    while (left < right) {
+        tuple pivot = neighbors[left + (right - left) / 2];
+        int i = left;
+        int j = right;
+        while (i <= j) {
+            while (isBetterNeighbor(&neighbors[i], &pivot)) i++;
+            while (isBetterNeighbor(&pivot, &neighbors[j])) j--;
+            if (i <= j) {
+                tuple swap = neighbors[i];
+                neighbors[i] = neighbors[j];
+                neighbors[j] = swap;
+                i++;
+                j--;
+            }
+        }
+        /* the neighbors in [left, j] are not worse than the pivot, the ones in [i, right] are not better */
+        if (k - 1 <= j) {
+            right = j;
+        } else if (k - 1 >= i) {
+            left = i;
+        } else {
+            break;
+        }
+    }
+}
+
+/** sorts the first k neighbors of a node, the neighbors behind the current prefix are selected and sorted only */
+static
+void extendSortedNeighbors(
+        sorted_neighbors *neighbors,
+        int node,
+        int k
+) {
+    int nsorted;
+
+    pthread_mutex_lock(&neighbors->mutex);
+    nsorted = atomic_load(&neighbors->nsorted[node]);
+    k = MIN(k, neighbors->nneighbors[node]);
+    if (nsorted < k) {
+        tuple *tail = &neighbors->sorted[node][nsorted];
+        if (k < neighbors->nneighbors[node]) {
+            selectNeighbors(tail, neighbors->nneighbors[node] - nsorted, k - nsorted);
+        }
+        qsort(tail, k - nsorted, sizeof(tail[0]), cmpNeighbors);
+        /* the workers only read the prefix, so the new entries are published after they are sorted */
+        atomic_store(&neighbors->nsorted[node], k);
+    }
+    pthread_mutex_unlock(&neighbors->mutex);
+}
+
+/** returns the i-th neighbor of a node by decreasing dual values, at least nUsedNeighbors are sorted at once */
+static inline
+int getSortedNeighbor(
+        sorted_neighbors *neighbors,
+        int node,
+        int i,
+        int nUsedNeighbors
+) {
+    assert(i < neighbors->nneighbors[node]);
+    if (i >= atomic_load(&neighbors->nsorted[node])) {
+        extendSortedNeighbors(neighbors, node, MAX(nUsedNeighbors, 2 * i));
+    }
+    return neighbors->sorted[node][i].index;
+}
+
 /** Calculates the latest arrival of each customer of this day */
 static
 SCIP_RETCODE getUpperTimeWindows(
@@ -101,8 +327,10 @@ SCIP_RETCODE getUpperTimeWindows(
         int day
 ) {
     int i;
-    neighbor *nb;
-    modelWindow *window;
+    int j;
+    int k;
+    neighbor_graph *graph = modeldata->neighborGraph;
+    window_table *table = modeldata->windowTable;
     assert(dualvalues != NULL);
     assert(permutedNeighbors != NULL);
     assert(npermutedNeighbors != NULL);
@@ -112,207 +340,633 @@ SCIP_RETCODE getUpperTimeWindows(
         upperTimeWindows[i] = 0;
     }
     /* just for all customers of this day, the upperTimeWindow will be set to the according nonzero value */
-    nb = modeldata->neighbors[modeldata->nC - 1][day];
-    while (nb != NULL) {
-        i = nb->id;
-        window = modeldata->timeWindows[i];//getNextTimeWindow(modeldata, i, day, modeldata->shift_start);
-        while (window != NULL) {
-            if (window->day != day) {
-                window = window->next;
-                continue;
-            }
-            if (window->end_t > upperTimeWindows[i]) {
-                upperTimeWindows[i] = window->end_t;
+    for (k = neighborGraphBegin(graph, modeldata->nC - 1, day); k < neighborGraphEnd(graph, modeldata->nC - 1, day); k++) {
+        i = neighborGraphHead(graph, k);
+        for (j = windowTableBegin(table, i, day); j < windowTableEnd(table, i, day); j++) {
+            if (table->end_t[j] > upperTimeWindows[i]) {
+                upperTimeWindows[i] = table->end_t[j];
             }
-            if (upperTimeWindows[modeldata->nC - 1] < window->start_t) {
-                upperTimeWindows[modeldata->nC - 1] = window->start_t;
+            if (upperTimeWindows[modeldata->nC - 1] < table->start_t[j]) {
+                upperTimeWindows[modeldata->nC - 1] = table->start_t[j];
             }
-            window = window->next;
         }
-        nb = nb->next;
     }
     return SCIP_OKAY;
 }
 
-/** Main method of the labeling algorithm
- * Calculates tours with minimal reduced costs */
+/** Computes the ng-neighborhood of each customer on this day. The neighborhood of a customer consists of itself and
+ *  its NG_NEIGHBORHOOD_SIZE nearest neighbors of the neighbor list. The neighborhoods are bit arrays of sizeBitarray
+ *  ints, the one of customer i starts at ngSets[i * sizeBitarray]. */
 static
-SCIP_RETCODE generateLabels(
+SCIP_RETCODE getNgNeighborhoods(
         SCIP *scip,
         model_data *modeldata,
-        label_list **bestLabels,
-        double *dualvalues,
-        SCIP_Bool *visited,
-        SCIP_Bool isFarkas,
-        SCIP_Bool isHeuristic,
         int day,
-        int nUsedNeighbors,
-        SCIP_Bool *toDepot
+        int sizeBitarray,
+        int **ngSets
 ) {
-    SCIP_PRICERDATA *pricerdata = SCIPpricerGetData(SCIPfindPricer(scip, "vrp"));
-    label_list **labellists = NULL;          /* a label list for each customer */
-    label_list **usedlabellists = NULL;      /* a label list for each customer for propagated labels */
-    label_list *depotlist = NULL;
-    labelVrp *label = NULL;
-    double sumNegativeRedCosts = 0.0;
-    double bestRedCost = 0.0;
-    tuple **permutedNeighbors;
+    int *nearest;
+    int nnearest;
+    int i;
+    int k;
+    assert(ngSets != NULL);
+    assert(modeldata->neighborGraph != NULL);
+
+    SCIP_CALL(threadAllocMemoryArray(ngSets, (modeldata->nC - 1) * sizeBitarray));
+    SCIP_CALL(threadAllocMemoryArray(&nearest, NG_NEIGHBORHOOD_SIZE + 1));
+    for (i = 0; i < modeldata->nC - 1; i++) {
+        int *ngSet = &(*ngSets)[i * sizeBitarray];
+        neighbor_graph *graph = modeldata->neighborGraph;
+        int pos;
+
+        /* keep the nearest neighbors sorted by increasing travel times */
+        nnearest = 0;
+        for (pos = neighborGraphBegin(graph, i, day); pos < neighborGraphEnd(graph, i, day); pos++) {
+            int head = neighborGraphHead(graph, pos);
+            if (head == i || nodeIsDepot(modeldata, head)) {
+                continue;
+            }
+            for (k = nnearest; k > 0 && modeldata->t_travel[i][nearest[k - 1]] > modeldata->t_travel[i][head]; k--) {
+                nearest[k] = nearest[k - 1];
+            }
+            nearest[k] = head;
+            nnearest = MIN(nnearest + 1, NG_NEIGHBORHOOD_SIZE);
+        }
+        for (k = 0; k < sizeBitarray; k++) {
+            ngSet[k] = 0;
+        }
+        SetBit(ngSet, i);
+        for (k = 0; k < nnearest; k++) {
+            SetBit(ngSet, nearest[k]);
+        }
+    }
+    threadFreeMemoryArray(&nearest);
+
+    return SCIP_OKAY;
+}
+
+/** returns the ng-neighborhood of a node, NULL if the labels are elementary or node is the depot */
+static
+int *getNgSet(
+        model_data *modeldata,
+        int *ngSets,
+        int sizeBitarray,
+        int node
+) {
+    if (ngSets == NULL || nodeIsDepot(modeldata, node)) {
+        return NULL;
+    }
+    return &ngSets[node * sizeBitarray];
+}
+
+/** labels of one worker, they are kept for the next labeling round of the day with a larger neighborhood */
+typedef struct _label_pool {
+    label_heap *openlabels;                  /* a heap of labels to be propagated for each customer */
+    label_list *depotlist;                   /* list of the start label */
+    label_index *index;                      /* dominance index of all active and propagated labels */
+    int *nUsedLab;                           /* number of propagated labels of each customer in the index */
+    int nlabels;                             /* number of labels that were added and not deleted while active */
+    int npropagatedLabels;
+    int totaldomi;
+    int totaldeleted;
+} label_pool;
+
+/** labels of the rounds of increasing neighborhood size of a day. A propagated label remembers
+ *  the first neighbor it was not propagated to, so a round with a larger neighborhood only adds the missing
+ *  propagations instead of starting again from the start label. */
+typedef struct _labeling_state {
+    label_pool **pools;                      /* pool of each worker, NULL if the worker was not started yet */
+    int npools;                              /* number of workers that were started */
+    int maxpools;
+    SCIP_Bool *isRootTaken;                  /* first customers that were taken by a worker in an earlier round */
+} labeling_state;
+
+/** data of one labeling run on a day that is shared by all of its workers, only the next root, the best reduced costs
+ *  and the cancel flag are changed while the workers are running */
+typedef struct _labeling_run {
+    SCIP *scip;
+    pricing_context *context;                /* read-only data of the pricing call */
+    model_data *modeldata;
+    double *dualvalues;
+    SCIP_Bool *visited;
+    SCIP_Bool isHeuristic;
+    int day;
+    int nUsedNeighbors;
+    int *ngSets;
+    completion_bound *completionBound;
+    warm_start *warmstart;                   /* paths of the last round that seed the open labels, NULL if not used */
+    sorted_neighbors *neighbors;             /* neighbors of the day, shared by all rounds of the day */
+    labeling_state *state;                   /* labels of the earlier rounds of the day */
+    tuple **permutedNeighbors;               /* the unsorted neighbors of neighbors */
     int *npermutedNeighbors;
     int *upperTimeWindows;
-    int npropagatedLabels = 0;
-    int nbestLabels = 0;
-    int nlabels = 0;
-    int nUsedLabels = 0;
-    int *nUsedLab;
+    double sumNegativeRedCosts;
+    int *roots;                              /* first customers of the tours, worker i takes the roots i, i + nworkers, ...,
+                                              * NULL if a single worker propagates the start label itself */
+    int nroots;
+    SCIP_Bool isTruncated;                   /* TRUE if the roots were limited by the neighborhood size */
+    int nworkers;
+    atomic_int isCancelled;                  /* set if one worker reached the time limit */
+    double bestRedCost;                      /* the tours must have smaller reduced costs, each worker lowers its own
+                                              * copy, so its labels do not depend on the progress of the others */
     time_t starttime;
+} labeling_run;
+
+/** a worker of a labeling run, its labels are located in its own arena */
+typedef struct _labeling_worker {
+    labeling_run *run;
+    label_arena *arena;
+    label_pool **pool;                       /* labels of the worker, created in its first round */
+    label_heap *bestLabels;
+    int *repeatedNodes;
+    labelVrp **keptLabels;                   /* labels of the dominance index at the end, sorted by reduced costs */
+    int nkeptLabels;
+    unsigned int randomState;                /* state of the random generator of the label selection */
+    int nextRoot;                            /* index of the next root of the worker in the roots of the run */
+    double minRedCost;                       /* smallest negative reduced costs of a tour at the depot, also of the
+                                              * rejected cycles, 0 if there is none */
+    SCIP_Bool isComplete;                    /* TRUE if all labels were propagated to all neighbors */
+} labeling_worker;
+
+/** creates the initial, empty label at the depot */
+static
+SCIP_RETCODE createStartLabel(
+        labeling_run *run,
+        label_arena *arena,
+        labelVrp **label
+) {
+    model_data *modeldata = run->modeldata;
+
+    SCIP_CALL(labelVrpCreateEmpty(run->scip, arena, label, modeldata->nC, modeldata->maxDelayEvents + 1,
+                                  -run->dualvalues[modeldata->nC - 1 + run->day], run->sumNegativeRedCosts, run->day));
+    assert(*label != NULL);
+    (*label)->lhs = run->dualvalues[modeldata->nC - 1 + run->day];
+    (*label)->redcost += ENFORCED_PRICE_COLLECTING * run->context->nEC[run->day];
+    (*label)->collactableRedcost -= ENFORCED_PRICE_COLLECTING * run->context->nEC[run->day];
+
+    return SCIP_OKAY;
+}
+
+/** Checks the bounds of a propagated label and computes its collectable reduced costs.
+ *  @return FALSE if the label can not be completed to a tour with reduced costs below bestRedCost */
+static
+SCIP_Bool isPromisingLabel(
+        labeling_run *run,
+        labelVrp *newLabel,
+        int *pathVisited,
+        double bestRedCost
+) {
+    pricing_context *context = run->context;
+
+    /* the rest of the tour cannot make up for the reduced costs of this label */
+    if (run->completionBound != NULL
+        && !contextIsSumNegative(context, newLabel->redcost - bestRedCost
+                                          + completionBoundGet(run->completionBound, newLabel->node,
+                                                               newLabel->arrivaltimes[0]))) {
+        return FALSE;
+    }
+    /* If in all cases this label would generate no label with better redcost than one already generated, delete it */
+    if (!contextIsSumNegative(context, newLabel->redcost + newLabel->collactableRedcost - bestRedCost)) {
+        return FALSE;
+    }
+    /* an ng-route label forgets visited customers, the bound is computed for elementary tours */
+    if (run->ngSets != NULL) {
+        labelVrpGetPathVisited(newLabel, pathVisited);
+    }
+    newLabel->collactableRedcost = labelVrpCollactableRedCostTimeDependent(context, newLabel, run->upperTimeWindows,
+                                                                           run->ngSets != NULL ? pathVisited : NULL);
+    return contextIsSumNegative(context, newLabel->redcost + newLabel->collactableRedcost - bestRedCost);
+}
+
+/** compare function for qsort, sorts labels by increasing reduced costs */
+static
+int cmpLabels(
+        const void *a,
+        const void *b
+) {
+    double redcostA = (*(labelVrp **) a)->redcost;
+    double redcostB = (*(labelVrp **) b)->redcost;
+    return (redcostA > redcostB) - (redcostA < redcostB);
+}
+
+/** returns TRUE if the arc between two nodes is available on the day of the run */
+static
+SCIP_Bool isNeighbor(
+        labeling_run *run,
+        int from,
+        int to
+) {
     int i;
-    int maxdomi = 0;
-    int test;
-    int totaldomi = 0;
-    int totaldeleted = 0;
-    int deletedLabels;
-    int dominanceStatus;
-    if (SCIPgetSolvingTime(scip) >= 3599.9)
-        return SCIP_OKAY;
 
-    assert(dualvalues != NULL);
-    assert(bestLabels != NULL);
-    /* if set, the labels with smallest, positive reduced costs are added if there are none with negative cost */
-    if (ADD_LABELS_POSITIVE_COST) {
-        bestRedCost = SCIP_DEFAULT_INFINITY;
+    for (i = 0; i < run->npermutedNeighbors[from]; i++) {
+        if (run->permutedNeighbors[from][i].index == to) {
+            return TRUE;
+        }
     }
+    return FALSE;
+}
 
-    /* Compute the maximum possible reduced costs, every tour could collect */
-    sumNegativeRedCosts = -sumOfPossibleDualvalues(scip, modeldata, dualvalues, day, isFarkas);
-    assert(sumNegativeRedCosts <= 0);
-    if (!SCIPisSumNegative(scip, sumNegativeRedCosts - dualvalues[modeldata->nC - 1 + day])) {
+/** Rebuilds the labels of the paths of the warm start with the current dual values and adds them to the open labels.
+ *  A path is dropped, if one of its arcs is not available anymore or one of its labels is infeasible or pruned.
+ *  The labels become children of the start label of the worker, the labels of their predecessors on the path are
+ *  neither open nor indexed. If root is not negative, only the paths that start at root are replayed. */
+static
+SCIP_RETCODE seedWarmStartLabels(
+        labeling_run *run,
+        labeling_worker *worker,
+        label_heap *openlabels,
+        label_index *index,
+        label_list *depotlist,
+        int *nUsedLab,
+        int *pathVisited,
+        double bestRedCost,
+        int root,
+        int *nlabels
+) {
+    SCIP *scip = run->scip;
+    warm_start *warmstart = run->warmstart;
+    int day = run->day;
+    int nseeded = 0;
+    int i;
+    int k;
+
+    for (i = 0; i < warmStartGetNPaths(warmstart, day); i++) {
+        int *path = warmStartGetPath(warmstart, day, i);
+        labelVrp *label = depotlist->label;
+        label_list *newList = NULL;
+        SCIP_Bool isDominated;
+        int deletedLabels = 0;
+
+        if (root >= 0 && path[0] != root) {
+            continue;
+        }
+        for (k = 0; k < warmStartGetPathLength(warmstart, day, i) && label != NULL; k++) {
+            labelVrp *newLabel = NULL;
+            if (path[k] == label->node || !isNeighbor(run, label->node, path[k])) {
+                label = NULL;
+                break;
+            }
+            SCIP_CALL(labelVrpPropagate(scip, worker->arena, run->context, label, &newLabel, path[k],
+                                        run->dualvalues[path[k]],
+                                        getNgSet(run->modeldata, run->ngSets, label->sizeBitarray, path[k])));
+            label = newLabel;
+        }
+        if (label == NULL) {
+            continue;
+        }
+        if (!isPromisingLabel(run, label, pathVisited, bestRedCost)) {
+            labelVrpFree(scip, &label);
+            continue;
+        }
+        SCIP_CALL(labellistDominanceCheck(scip, index, openlabels, label, &isDominated, &deletedLabels, nUsedLab));
+        *nlabels -= deletedLabels;
+        if (isDominated) {
+            labelVrpFree(scip, &label);
+            continue;
+        }
+        SCIP_CALL(labellistCreate(scip, &newList, label, getOpenLabelValue(label)));
+        SCIP_CALL(labelHeapInsert(scip, &openlabels[label->node], newList));
+        SCIP_CALL(labelIndexInsert(scip, index, newList));
+        newList->parent = depotlist;
+        newList->nextSibling = depotlist->child;
+        if (depotlist->child != NULL) {
+            depotlist->child->prevSibling = newList;
+        }
+        depotlist->child = newList;
+        (*nlabels)++;
+        nseeded++;
+    }
+    SCIPdebugMessage("day %d: %d of %d labels of the last round are open labels again\n", day, nseeded,
+                     warmStartGetNPaths(warmstart, day));
+
+    return SCIP_OKAY;
+}
+
+/** Keeps the labels of the dominance index with the smallest reduced costs in the worker, at most WARM_START_LABELS */
+static
+SCIP_RETCODE keepBestLabels(
+        labeling_worker *worker,
+        label_index *index
+) {
+    int nentries = 0;
+    int b;
+    int j;
+
+    worker->nkeptLabels = 0;
+    for (b = 0; b < index->nnodes * index->nbuckets; b++) {
+        nentries += index->buckets[b].nentries;
+    }
+    if (nentries == 0) {
         return SCIP_OKAY;
     }
-    /* precompute the sequence of neighbors for every node, sorted by dualvalues */
-    SCIP_CALL(SCIPallocMemoryArray(scip, &nUsedLab, modeldata->nC - 1));
-    SCIP_CALL(SCIPallocMemoryArray(scip, &permutedNeighbors, modeldata->nC));
-    SCIP_CALL(SCIPallocMemoryArray(scip, &npermutedNeighbors, modeldata->nC));
+    SCIP_CALL(threadAllocMemoryArray(&worker->keptLabels, nentries));
+    for (b = 0; b < index->nnodes * index->nbuckets; b++) {
+        for (j = 0; j < index->buckets[b].nentries; j++) {
+            worker->keptLabels[worker->nkeptLabels++] = index->buckets[b].entries[j]->label;
+        }
+    }
+    qsort(worker->keptLabels, worker->nkeptLabels, sizeof(worker->keptLabels[0]), cmpLabels);
+    worker->nkeptLabels = MIN(worker->nkeptLabels, WARM_START_LABELS);
 
-    SCIP_CALL(getNeighborsSorted(scip, modeldata, permutedNeighbors, npermutedNeighbors, dualvalues, day));
-    /* compute the upper limit for a possible arrivaltime at each customer */
-    SCIP_CALL(SCIPallocMemoryArray(scip, &upperTimeWindows, modeldata->nC));
-    SCIP_CALL(getUpperTimeWindows(scip, modeldata, dualvalues, permutedNeighbors, npermutedNeighbors, upperTimeWindows,
-                                  day));
-    /* create the initial, empty label */
-    labelVrpCreateEmpty(scip, &label, modeldata->nC, modeldata->maxDelayEvents + 1,
-                        -dualvalues[modeldata->nC - 1 + day], sumNegativeRedCosts, day);
-    assert(label != NULL);
-    nlabels++;
-
-    /* initialize labellists */
-    SCIP_CALL(SCIPallocMemoryArray(scip, &labellists, modeldata->nC - 1));
-    SCIP_CALL(SCIPallocMemoryArray(scip, &usedlabellists, modeldata->nC - 1));
+    return SCIP_OKAY;
+}
+
+/** Replaces the paths of the warm start of the day by the best kept labels of all workers */
+static
+SCIP_RETCODE updateWarmStart(
+        labeling_run *run,
+        labeling_worker *workers,
+        int nworkers
+) {
+    labelVrp **labels = NULL;
+    int nlabels = 0;
+    int i;
+    int j;
+
+    for (i = 0; i < nworkers; i++) {
+        nlabels += workers[i].nkeptLabels;
+    }
+    /* a round without labels, e.g. because of the time limit, keeps the paths of the last one */
+    if (nlabels > 0) {
+        SCIP_CALL(threadAllocMemoryArray(&labels, nlabels));
+        nlabels = 0;
+        for (i = 0; i < nworkers; i++) {
+            for (j = 0; j < workers[i].nkeptLabels; j++) {
+                labels[nlabels++] = workers[i].keptLabels[j];
+            }
+        }
+        qsort(labels, nlabels, sizeof(labels[0]), cmpLabels);
+        warmStartClear(run->warmstart, run->day);
+        for (i = 0; i < nlabels; i++) {
+            warmStartAddLabel(run->warmstart, labels[i]);
+        }
+        threadFreeMemoryArray(&labels);
+    }
+    for (i = 0; i < nworkers; i++) {
+        threadFreeMemoryArrayNull(&workers[i].keptLabels);
+    }
+
+    return SCIP_OKAY;
+}
+
+/** creates the pool of a worker with the start label, which is an open label of a single worker */
+static
+SCIP_RETCODE createLabelPool(
+        labeling_run *run,
+        labeling_worker *worker,
+        label_pool **pool
+) {
+    SCIP *scip = run->scip;
+    model_data *modeldata = run->modeldata;
+    labelVrp *label = NULL;
+    int i;
+
+    SCIP_CALL(threadAllocMemory(pool));
+    SCIP_CALL(threadAllocMemoryArray(&(*pool)->nUsedLab, modeldata->nC - 1));
+    SCIP_CALL(threadAllocMemoryArray(&(*pool)->openlabels, modeldata->nC - 1));
     for (i = 0; i < modeldata->nC - 1; i++) {
-        labellists[i] = NULL;
-        usedlabellists[i] = NULL;
-        nUsedLab[i] = 0;
-    }
-    label->lhs = dualvalues[modeldata->nC - 1 + day];
-    label->redcost += ENFORCED_PRICE_COLLECTING * pricerdata->nEC[day];
-    label->collactableRedcost -= ENFORCED_PRICE_COLLECTING * pricerdata->nEC[day];
-    SCIP_CALL(labellistCreate(scip, &depotlist, label, 0));
-    labellists[0] = depotlist;
-    starttime = time(NULL);
-//
-//   if(pricerdata->nEC[day] > 0)
-//   {
-//       labelVrpPrint(label);
-//       assert(FALSE);
-//   }
+        labelHeapInit(&(*pool)->openlabels[i]);
+        (*pool)->nUsedLab[i] = 0;
+    }
+    (*pool)->npropagatedLabels = 0;
+    (*pool)->totaldomi = 0;
+    (*pool)->totaldeleted = 0;
+
+    /* create the initial, empty label */
+    SCIP_CALL(createStartLabel(run, worker->arena, &label));
+    (*pool)->nlabels = 1;
+    SCIP_CALL(labelIndexCreate(scip, &(*pool)->index, modeldata->nC - 1, label->narrivaltimes, label->sizeBitarray,
+                               modeldata->shift_start, modeldata->shift_end));
+    (*pool)->depotlist = NULL;
+    SCIP_CALL(labellistCreate(scip, &(*pool)->depotlist, label, 0));
+    if (run->roots == NULL) {
+        SCIP_CALL(labelHeapInsert(scip, &(*pool)->openlabels[0], (*pool)->depotlist));
+    } else {
+        /* the start label of a worker is only propagated to the roots it takes */
+        (*pool)->depotlist->isPropagated = TRUE;
+        (*pool)->npropagatedLabels++;
+    }
+
+    return SCIP_OKAY;
+}
+
+/** frees the pool of a worker, the labels and labellists stay in the arena */
+static
+SCIP_RETCODE freeLabelPool(
+        SCIP *scip,
+        int nC,
+        label_pool **pool
+) {
+    int i;
+
+    assert(pool != NULL);
+    if (*pool == NULL) {
+        return SCIP_OKAY;
+    }
+    SCIP_CALL(labelIndexFree(scip, &(*pool)->index));
+    for (i = 0; i < nC - 1; i++) {
+        labelHeapExit(scip, &(*pool)->openlabels[i]);
+    }
+    threadFreeMemoryArray(&(*pool)->openlabels);
+    threadFreeMemoryArray(&(*pool)->nUsedLab);
+    threadFreeMemory(pool);
+
+    return SCIP_OKAY;
+}
+
+/** opens the labels of the pool again, whose propagation stopped at the neighborhood size of the last round */
+static
+SCIP_RETCODE reopenLabels(
+        SCIP *scip,
+        label_pool *pool
+) {
+    label_index *index = pool->index;
+    int nreopened = 0;
+    int b;
+    int j;
+
+    /* the start label is not part of the dominance index */
+    if (pool->depotlist->nextNeighbor > 0 && pool->depotlist->heappos < 0) {
+        SCIP_CALL(labelHeapInsert(scip, &pool->openlabels[0], pool->depotlist));
+        nreopened++;
+    }
+    for (b = 0; b < index->nnodes * index->nbuckets; b++) {
+        for (j = 0; j < index->buckets[b].nentries; j++) {
+            label_list *list = index->buckets[b].entries[j];
+            if (list->isPropagated && list->nextNeighbor > 0 && list->heappos < 0) {
+                SCIP_CALL(labelHeapInsert(scip, &pool->openlabels[list->label->node], list));
+                nreopened++;
+            }
+        }
+    }
+    pool->npropagatedLabels -= nreopened;
+    SCIPdebugMessage("%d of %d labels are opened again for a larger neighborhood\n", nreopened, pool->nlabels);
+
+    return SCIP_OKAY;
+}
+
+/** Propagates the labels of one worker until all of them are processed.
+ *  A single worker starts with the start label at the depot. If the run has roots, the workers have their own copy
+ *  of the start label and take their next root whenever they run out of open labels, the start label is then only
+ *  propagated to this first customer. The roots are split statically and the dominance check and the best reduced
+ *  costs only regard labels of the same worker, so the labels of a worker do not depend on the timing of the others.
+ *  With a warm start, the labels of the paths of the last round are open labels from the beginning, a worker with
+ *  roots replays the paths of a root when it takes the root.
+ *  The labels stay in the pool of the worker. In the next round with a larger neighborhood, the labels that stopped
+ *  at the last neighborhood size are opened again and continue at their first missing neighbor. */
+static
+SCIP_RETCODE propagateLabels(
+        labeling_run *run,
+        labeling_worker *worker
+) {
+    SCIP *scip = run->scip;
+    pricing_context *context = run->context;
+    model_data *modeldata = run->modeldata;
+    label_arena *arena = worker->arena;
+    label_heap *bestLabels = worker->bestLabels;
+    double *dualvalues = run->dualvalues;
+    SCIP_Bool *visited = run->visited;
+    SCIP_Bool isHeuristic = run->isHeuristic;
+    SCIP_Bool *toDepot = context->toDepot;
+    int *ngSets = run->ngSets;
+    int *repeatedNodes = worker->repeatedNodes;
+    int *npermutedNeighbors = run->npermutedNeighbors;
+    int day = run->day;
+    int nUsedNeighbors = run->nUsedNeighbors;
+    label_pool *pool = NULL;
+    label_heap *openlabels = NULL;           /* a heap of labels to be propagated for each customer */
+    label_list *depotlist = NULL;
+    label_index *index = NULL;               /* dominance index of all active and propagated labels */
+    labelVrp *label = NULL;
+    int *pathVisited = NULL;                 /* customers on the path of a label in ng-route mode */
+    double bestRedCost = run->bestRedCost;
+    int npropagatedLabels;
+    int nroundLabels;                        /* propagated labels at the start of this round */
+    int nbestLabels = 0;
+    int nlabels;
+    int nUsedLabels = 0;
+    int *nUsedLab;
+    int first;
+    int i;
+    int totaldomi;
+    int totaldeleted;
+    int deletedLabels;
+    SCIP_Bool isDominated;
+    SCIP_Bool isNewPool = (*worker->pool == NULL);
+    SCIP_Bool isReopened;
+    SCIP_Bool isTruncated = FALSE;           /* TRUE if a label was not propagated to all neighbors */
+
+    /* the labels of the earlier rounds are kept, the ones that reached the last neighborhood size are open again */
+    if (isNewPool) {
+        SCIP_CALL(createLabelPool(run, worker, worker->pool));
+    } else {
+        SCIP_CALL(reopenLabels(scip, *worker->pool));
+    }
+    pool = *worker->pool;
+    openlabels = pool->openlabels;
+    depotlist = pool->depotlist;
+    index = pool->index;
+    nUsedLab = pool->nUsedLab;
+    nlabels = pool->nlabels;
+    npropagatedLabels = pool->npropagatedLabels;
+    totaldomi = pool->totaldomi;
+    totaldeleted = pool->totaldeleted;
+    nroundLabels = npropagatedLabels;
+
+    if (ngSets != NULL) {
+        SCIP_CALL(threadAllocMemoryArray(&pathVisited, depotlist->label->sizeBitarray));
+    }
+    if (isNewPool && run->warmstart != NULL && run->roots == NULL) {
+        SCIP_CALL(seedWarmStartLabels(run, worker, openlabels, index, depotlist, nUsedLab, pathVisited, bestRedCost,
+                                      -1, &nlabels));
+    }
 
     /** labeling algorithm */
-    while (npropagatedLabels < nlabels) {
-        if (SCIPgetSolvingTime(scip) >= 3600)
+    while (!atomic_load(&run->isCancelled)) {
+        if (time(NULL) >= context->deadline)
             break;
         labelVrp *newLabel = NULL;
         label_list *newList = NULL;
         label_list *lastList = NULL;
         label_list *currentList = NULL;
+        int root = -1;  /* the first customer, if the start label is propagated for a root */
         int p = 0;  /* Number of neighbors this label was already propagated to */
-        assert(nlabels - npropagatedLabels == labellistsTotalLength(labellists, modeldata->nC - 1));
-        /* get the next label and propagate it to all neighbors */
-        label = NULL;
-        SCIP_CALL(getNextList(scip, labellists, &currentList, modeldata->nC - 1));
+        assert(nlabels - npropagatedLabels == labelheapsTotalLength(openlabels, modeldata->nC - 1));
+        /* get the next label and propagate it to all neighbors, or take the next root if there is none */
+        if (npropagatedLabels == nlabels) {
+            if (worker->nextRoot >= run->nroots) {
+                worker->isComplete = !isTruncated;
+                break;
+            }
+            root = run->roots[worker->nextRoot];
+            worker->nextRoot += run->nworkers;
+            currentList = depotlist;
+            if (run->warmstart != NULL) {
+                SCIP_CALL(seedWarmStartLabels(run, worker, openlabels, index, depotlist, nUsedLab, pathVisited,
+                                              bestRedCost, root, &nlabels));
+            }
+        } else {
+            SCIP_CALL(getNextList(scip, openlabels, &currentList, modeldata->nC - 1, &worker->randomState));
+            npropagatedLabels++;
+        }
         label = currentList->label;
-        npropagatedLabels++;
         assert(label != NULL);
+        /* a label of an earlier round continues at the first neighbor it was not propagated to */
+        isReopened = (root < 0 && currentList->nextNeighbor > 0);
+        first = 0;
+        if (isReopened) {
+            first = currentList->nextNeighbor;
+            p = currentList->npropagated;
+        }
         /* propagate this label to all neighbors */
-        for (i = 0; i < npermutedNeighbors[label->node]; i++) {
+        for (i = (root >= 0 ? 0 : first); i < (root >= 0 ? 1 : npermutedNeighbors[label->node]); i++) {
+            int next = (root >= 0 ? root : getSortedNeighbor(run->neighbors, label->node, i, nUsedNeighbors));
             newList = NULL;
             /* if this label was already propagated to many neighbors, skip the other ones */
             if (p >= nUsedNeighbors) {
+                isTruncated = TRUE;
                 break;
             }
             /* scip the next customer, if this would create a loop or he was already visited on another day */
-            if (permutedNeighbors[label->node][i].index == label->node ||
-                (isHeuristic && (visited[permutedNeighbors[label->node][i].index] == TRUE))) {
+            if (next == label->node || (isHeuristic && (visited[next] == TRUE))) {
                 continue;
             }
             newLabel = NULL;
-            labelVrpPropagate(scip, pricerdata, modeldata, label, &newLabel, permutedNeighbors[label->node][i].index,
-                              dualvalues[permutedNeighbors[label->node][i].index], isFarkas);
+            SCIP_CALL(labelVrpPropagate(scip, arena, context, label, &newLabel, next, dualvalues[next],
+                                        getNgSet(modeldata, ngSets, label->sizeBitarray, next)));
             if (newLabel != NULL) {
-                /* If in all cases this label would generate no label with better redcost than one already generated, delete it */
-                if (!SCIPisSumNegative(scip, newLabel->redcost + newLabel->collactableRedcost - bestRedCost)) {
-                    labelVrpFree(scip, &newLabel);
-                    continue;
-                }
-                newLabel->collactableRedcost = labelVrpCollactableRedCostTimeDependent(scip, modeldata, newLabel,
-                                                                                       dualvalues, upperTimeWindows);
-                if (!SCIPisSumNegative(scip, newLabel->redcost + newLabel->collactableRedcost - bestRedCost)) {
+                if (!isPromisingLabel(run, newLabel, pathVisited, bestRedCost)) {
                     labelVrpFree(scip, &newLabel);
                     continue;
                 }
                 /**** dominance check ****/
-                dominanceStatus = labellistDominanceCheck(scip, labellists, &labellists[newLabel->node], newLabel,
-                                                          FALSE, NULL, NULL);
                 deletedLabels = 0;
-
-                test = labellistDominanceCheck(scip, labellists, usedlabellists, newLabel, TRUE, &deletedLabels,
-                                               nUsedLab);
+                SCIP_CALL(labellistDominanceCheck(scip, index, openlabels, newLabel, &isDominated, &deletedLabels,
+                                                  nUsedLab));
                 nlabels -= deletedLabels;
                 totaldeleted += deletedLabels;
+                totaldomi += deletedLabels;
 
-                if (dominanceStatus == 0) {
-                    dominanceStatus = test;
-                }
-                if (dominanceStatus > maxdomi) maxdomi = dominanceStatus;
-                switch (dominanceStatus) {
-                    /* this label is dominated, no adding to the pool */
-                    case -1:
-                        labelVrpFree(scip, &newLabel);
-                        totaldomi++;
-                        break;
-                        /* dominance check was meaningless, add this label */
-                    case 0:
-                        assert(newList == NULL);
-                        labellistInsertNew(scip, &labellists[newLabel->node], newLabel, &newList, newLabel->redcost);
-                        assert(newList != NULL);
-                        p++;
-                        nlabels++;
-                        break;
-                        /* If this label dominates another label already in the list, the other one was deleted, add this label */
-                    default:
-                        labellistInsertNew(scip, &labellists[newLabel->node], newLabel, &newList, newLabel->redcost);
-                        assert(newList != NULL);
-                        nlabels += 1 - dominanceStatus;
-                        p++;
-                        totaldomi += dominanceStatus;
-                        if (dominanceStatus < -1) {
-                            SCIPwarningMessage(scip, "Error in dominance check, return value was: %d\n",
-                                               dominanceStatus);
-                            SCIPABORT();
-                        }
-                        break;
+                /* this label is dominated, no adding to the pool */
+                if (isDominated) {
+                    labelVrpFree(scip, &newLabel);
+                    totaldomi++;
+                } else {
+                    /* If this label dominates other labels, they were deleted, add this label */
+                    assert(newList == NULL);
+                    SCIP_CALL(labellistCreate(scip, &newList, newLabel, getOpenLabelValue(newLabel)));
+                    SCIP_CALL(labelHeapInsert(scip, &openlabels[newLabel->node], newList));
+                    SCIP_CALL(labelIndexInsert(scip, index, newList));
+                    p++;
+                    nlabels++;
                 }
-                if (dominanceStatus >= 0) {
-                    /* if label was added, set label-tree data */
+                if (!isDominated) {
+                    /* if label was added, set label-tree data, the start label of a worker gets a child per root */
                     if (lastList == NULL) {
+                        newList->nextSibling = currentList->child;
+                        if (currentList->child != NULL) {
+                            currentList->child->prevSibling = newList;
+                        }
                         currentList->child = newList;
                     } else {
                         lastList->nextSibling = newList;
@@ -324,37 +978,51 @@ SCIP_RETCODE generateLabels(
             }
         }
 
-        /* also propagate this label to the depot, if it is not the initial label */
-        if (label->node == modeldata->nC - 1) {
+        if (root < 0) {
+            currentList->nextNeighbor = (i < npermutedNeighbors[label->node] ? i : -1);
+            currentList->npropagated = p;
+        }
+
+        /* also propagate this label to the depot, if it is not the initial label and was not propagated before */
+        if (label->node == modeldata->nC - 1 || isReopened) {
             continue;
         }
         /* continue if the arc to the depot is not available due to branching decisions */
         newLabel = NULL;
         if (toDepot[label->node]) {
-            labelVrpPropagate(scip, pricerdata, modeldata, label, &newLabel, modeldata->nC - 1, 0, isFarkas);
+            SCIP_CALL(labelVrpPropagate(scip, arena, context, label, &newLabel, modeldata->nC - 1, 0, NULL));
         }
 
-        /* add propagated label to usedlabellist of current node */
+        /* the propagated label stays in the dominance index of the current node */
         currentList->isPropagated = TRUE;
-        currentList->next = NULL;
-        currentList->prev = NULL;
-        labellistInsertNew(scip, &usedlabellists[label->node], label, &currentList, label->redcost);
         nUsedLab[label->node]++;
 
+        /* the tours that are rejected or already contained in the master problem also count for the bound */
+        if (newLabel != NULL && contextIsSumNegative(context, newLabel->redcost)) {
+            worker->minRedCost = MIN(worker->minRedCost, newLabel->redcost);
+        }
+        /* an ng-route tour with a cycle must not enter the master problem */
+        if (newLabel != NULL && ngSets != NULL && contextIsSumNegative(context, newLabel->redcost - bestRedCost)
+            && !labelVrpIsElementary(newLabel)) {
+            labelVrpAddRepeatedNodes(newLabel, repeatedNodes);
+            labelVrpFree(scip, &newLabel);
+            newLabel = NULL;
+        }
         if (newLabel != NULL) {
             /* If this is a label with negative reduced costs, which is feasible,
              * add it to the pool and update the value for the current best reduced costs */
-            if (SCIPisSumNegative(scip, newLabel->redcost - bestRedCost)) {
+            if (contextIsSumNegative(context, newLabel->redcost - bestRedCost)) {
+                label_list *bestList = NULL;
                 bestRedCost = newLabel->redcost;
-                SCIP_CALL(labellistInsert(scip, bestLabels, newLabel, newLabel->redcost));
-                assert(*bestLabels != NULL);
+                SCIP_CALL(labellistCreate(scip, &bestList, newLabel, newLabel->redcost));
+                SCIP_CALL(labelHeapInsert(scip, bestLabels, bestList));
                 nbestLabels++;
             } else {
                 labelVrpFree(scip, &newLabel);
                 newLabel = NULL;
             }
         }
-        if (time(NULL) - starttime > LABELING_TIME_LIMIT && nbestLabels > 0)
+        if (time(NULL) - run->starttime > LABELING_TIME_LIMIT && nbestLabels > 0)
             break;
         /* early stopping is not allowed, if this is exact pricing */
         if (!isHeuristic) {
@@ -363,9 +1031,9 @@ SCIP_RETCODE generateLabels(
                     nUsedLabels = 0;
                     for (i = 0; i < modeldata->nC - 1; i++) nUsedLabels += nUsedLab[i];
 
-                    printf("day: %d, nlabels: %d, npropagated: %d, nbest: %d, toCheck: %d, active old Labels: %d, deleted labels: %d\n",
+                    printf("day: %d, nlabels: %d, npropagated: %d, nbest: %d, toCheck: %d, active old Labels: %d, deleted labels: %d, compared: %lld, skipped: %lld\n",
                            day, nlabels, npropagatedLabels, nbestLabels, nlabels - npropagatedLabels, nUsedLabels,
-                           totaldeleted + npropagatedLabels - nUsedLabels);
+                           totaldeleted + npropagatedLabels - nUsedLabels, index->ncompared, index->nskipped);
                 }
             }
             if (nbestLabels > MAX_CREATED_LABELS || (nlabels * nbestLabels > 500000)) {
@@ -374,14 +1042,16 @@ SCIP_RETCODE generateLabels(
                     printf("day: %d, nlabels: %d, npropagated: %d, nbest: %d, toCheck: %d\n", day, nlabels,
                            npropagatedLabels, nbestLabels, nlabels - npropagatedLabels);
                 }
+                /* only this worker stops, so the tours of the others do not depend on when it stopped */
                 break;
             }
-            if (time(NULL) - starttime > LABELING_TIME_LIMIT && HEURISTIC_DOMINANCE) {
+            if (time(NULL) - run->starttime > LABELING_TIME_LIMIT && HEURISTIC_DOMINANCE) {
                 if (nUsedNeighbors >= modeldata->nC - 1) {
                     SCIPwarningMessage(scip,
                                        "Labeling-Iteration cancelled by time limit on day %d. Optimality of computed solution is not guaranteed.\n",
                                        day);
                 }
+                atomic_store(&run->isCancelled, TRUE);
                 break;
             }
             continue;
@@ -389,47 +1059,352 @@ SCIP_RETCODE generateLabels(
 
         /* Heuristic call:
         *  pricing is stopped early, if there are too many labels or almost every label has negative reduced cost */
-        if (npropagatedLabels > MAX_CREATED_LABELS ||
-            (nbestLabels > MIN_REQUIRED_LABELS && (npropagatedLabels / nbestLabels) < 1.5)) {
+        if (npropagatedLabels - nroundLabels > MAX_CREATED_LABELS ||
+            (nbestLabels > MIN_REQUIRED_LABELS && ((npropagatedLabels - nroundLabels) / nbestLabels) < 1.5)) {
             assert(isHeuristic);
             SCIPdebugMessage("Heuristic pricing cancelled by too many labels\n");
             break;
         }
     }
 
-    /* free memory */
-    if (depotlist != NULL) labellistDestroy(scip, depotlist);
-    for (i = 0; i < modeldata->nC; i++) {
-        SCIPfreeMemoryArray(scip, &(permutedNeighbors[i]));
+    SCIPdebugMessage("day %d: %lld dominance comparisons, %lld skipped by the index\n", day, index->ncompared,
+                     index->nskipped);
+    if (run->warmstart != NULL) {
+        SCIP_CALL(keepBestLabels(worker, index));
     }
-    for (i = 0; i < modeldata->nC - 1; i++) {
-        if (SCIPgetSolvingTime(scip) >= 3600)
-            break;
-        SCIP_CALL(labellistDestroy(scip, usedlabellists[i]));
-        SCIP_CALL(labellistDestroy(scip, labellists[i]));
+
+    /* the labels stay in the pool for the next round */
+    pool->nlabels = nlabels;
+    pool->npropagatedLabels = npropagatedLabels;
+    pool->totaldomi = totaldomi;
+    pool->totaldeleted = totaldeleted;
+    threadFreeMemoryArrayNull(&pathVisited);
+
+    return SCIP_OKAY;
+}
+
+/** runs a worker of a labeling run as a task of the thread pool */
+static
+SCIP_RETCODE labelingWorkerTask(void *arguments) {
+    labeling_worker *worker = arguments;
+
+    assert(worker != NULL);
+
+    return propagateLabels(worker->run, worker);
+}
+
+/** Returns the number of workers that share the exact labeling of one day. If INTRA_DAY_THREADS is 0, the threads of
+ *  the pool and the waiting thread are split evenly over the days. */
+static
+int getNIntraDayWorkers(
+        pricing_context *context
+) {
+    if (INTRA_DAY_THREADS > 0) {
+        return INTRA_DAY_THREADS;
+    }
+    if (context->pool == NULL) {
+        return 1;
+    }
+    return (context->pool->nthreads + context->modeldata->nDays) / context->modeldata->nDays;
+}
+
+/** Computes the first customers of the tours in the order in which the start label would be propagated to them.
+ *  The customers that were taken in an earlier round of the day count for the neighborhood size, but are left out. */
+static
+SCIP_RETCODE getRootCustomers(
+        labeling_run *run,
+        label_arena *arena,
+        int *roots,
+        int *nroots
+) {
+    SCIP *scip = run->scip;
+    model_data *modeldata = run->modeldata;
+    labelVrp *startLabel = NULL;
+    int *pathVisited = NULL;
+    double bestRedCost = run->bestRedCost;
+    int naccepted = 0;
+    int depot = modeldata->nC - 1;
+    int i;
+
+    SCIP_CALL(createStartLabel(run, arena, &startLabel));
+    SCIP_CALL(threadAllocMemoryArray(&pathVisited, startLabel->sizeBitarray));
+
+    *nroots = 0;
+    for (i = 0; i < run->npermutedNeighbors[depot] && naccepted < run->nUsedNeighbors; i++) {
+        int next = getSortedNeighbor(run->neighbors, depot, i, run->nUsedNeighbors);
+        labelVrp *newLabel = NULL;
+
+        if (next == depot) {
+            continue;
+        }
+        /* the labels of this root are already in the pool of a worker */
+        if (run->state->isRootTaken[next]) {
+            naccepted++;
+            continue;
+        }
+        SCIP_CALL(labelVrpPropagate(scip, arena, run->context, startLabel, &newLabel, next, run->dualvalues[next],
+                                    getNgSet(modeldata, run->ngSets, startLabel->sizeBitarray, next)));
+        if (newLabel == NULL) {
+            continue;
+        }
+        if (isPromisingLabel(run, newLabel, pathVisited, bestRedCost)) {
+            roots[(*nroots)++] = next;
+            naccepted++;
+        }
+        labelVrpFree(scip, &newLabel);
     }
-    SCIPfreeMemoryArray(scip, &nUsedLab);
-    SCIPfreeMemoryArray(scip, &usedlabellists);
-    SCIPfreeMemoryArray(scip, &labellists);
-    SCIPfreeMemoryArray(scip, &permutedNeighbors);
-    SCIPfreeMemoryArray(scip, &npermutedNeighbors);
-    SCIPfreeMemoryArray(scip, &upperTimeWindows);
+    run->isTruncated = (i < run->npermutedNeighbors[depot]);
+    threadFreeMemoryArray(&pathVisited);
 
     return SCIP_OKAY;
 }
 
-/* add the best label(s) to the master problem */
+/** creates an empty state for the labeling rounds of a day */
+static
+SCIP_RETCODE createLabelingState(
+        pricing_context *context,
+        labeling_state **state
+) {
+    int i;
+
+    assert(state != NULL);
+
+    SCIP_CALL(threadAllocMemory(state));
+    (*state)->maxpools = MAX(1, getNIntraDayWorkers(context));
+    SCIP_CALL(threadAllocMemoryArray(&(*state)->pools, (*state)->maxpools));
+    for (i = 0; i < (*state)->maxpools; i++) {
+        (*state)->pools[i] = NULL;
+    }
+    (*state)->npools = 0;
+    SCIP_CALL(threadAllocClearMemoryArray(&(*state)->isRootTaken, context->modeldata->nC));
+
+    return SCIP_OKAY;
+}
+
+/** frees a labeling state, the labels stay in the arena */
+static
+SCIP_RETCODE freeLabelingState(
+        SCIP *scip,
+        int nC,
+        labeling_state **state
+) {
+    int i;
+
+    assert(state != NULL);
+    if (*state == NULL) {
+        return SCIP_OKAY;
+    }
+    for (i = 0; i < (*state)->maxpools; i++) {
+        SCIP_CALL(freeLabelPool(scip, nC, &(*state)->pools[i]));
+    }
+    threadFreeMemoryArray(&(*state)->isRootTaken);
+    threadFreeMemoryArray(&(*state)->pools);
+    threadFreeMemory(state);
+
+    return SCIP_OKAY;
+}
+
+/** Main method of the labeling algorithm
+ * Calculates tours with minimal reduced costs.
+ * All labels are taken from the arena. The labels in bestLabels refer to their parents, so the arena must not be
+ * reset before the tours are added to the master problem.
+ * If ngSets is given, the labels are ng-routes, which only remember the visited customers of the ng-neighborhood of
+ * their node. Tours with cycles are not added to bestLabels, the bits of their repeated customers are set in
+ * repeatedNodes instead.
+ * If completionBound is given, labels that cannot be completed to a tour with better reduced costs are discarded.
+ * In exact labeling with more than one intra-day worker, the first customers of the tours are distributed over
+ * workers that run as tasks of the thread pool of the pricer. The first customers are split round robin in the order
+ * of the sorted neighbors of the depot, so the tours do not depend on the timing of the threads. A worker takes its
+ * next first customer when it has no open labels left, its labels are taken from a child arena of arena.
+ * The labels are kept in state, a later round on the same state with a larger nUsedNeighbors
+ * only propagates the labels to the neighbors that were not allowed before.
+ * minRedCost is set to the smallest negative reduced costs of all tours that were found, including the rejected
+ * cycles, or 0 if there is none. isComplete is set to TRUE if no label was left out, then no tour has smaller reduced
+ * costs than minRedCost. */
+static
+SCIP_RETCODE generateLabels(
+        SCIP *scip,
+        label_arena *arena,
+        pricing_context *context,
+        label_heap *bestLabels,
+        SCIP_Bool *visited,
+        SCIP_Bool isHeuristic,
+        int day,
+        sorted_neighbors *neighbors,
+        labeling_state *state,
+        int nUsedNeighbors,
+        int *ngSets,
+        int *repeatedNodes,
+        completion_bound *completionBound,
+        double *minRedCost,
+        SCIP_Bool *isComplete
+) {
+    model_data *modeldata = context->modeldata;
+    double *dualvalues = context->dualvalues;
+    labeling_run run;
+    labeling_worker *workers = NULL;
+    thread_group group;
+    int nworkers = 1;
+    int i;
+    int k;
+    int r;
+    *minRedCost = 0.0;
+    *isComplete = FALSE;
+    if (time(NULL) >= context->deadline)
+        return SCIP_OKAY;
+
+    assert(dualvalues != NULL);
+    assert(bestLabels != NULL);
+    run.scip = scip;
+    run.context = context;
+    run.modeldata = modeldata;
+    run.dualvalues = dualvalues;
+    run.visited = visited;
+    run.isHeuristic = isHeuristic;
+    run.day = day;
+    run.nUsedNeighbors = nUsedNeighbors;
+    run.ngSets = ngSets;
+    run.completionBound = completionBound;
+    run.warmstart = (isHeuristic ? NULL : context->warmstart);
+    run.neighbors = neighbors;
+    run.state = state;
+    run.permutedNeighbors = neighbors->neighbors;
+    run.npermutedNeighbors = neighbors->nneighbors;
+    run.roots = NULL;
+    run.nroots = 0;
+    run.isTruncated = FALSE;
+    run.nworkers = 1;
+    atomic_init(&run.isCancelled, FALSE);
+    /* if set, the labels with smallest, positive reduced costs are added if there are none with negative cost */
+    run.bestRedCost = (ADD_LABELS_POSITIVE_COST ? SCIP_DEFAULT_INFINITY : 0.0);
+
+    /* Compute the maximum possible reduced costs, every tour could collect */
+    run.sumNegativeRedCosts = -context->possibleDualvalues[day];
+    assert(run.sumNegativeRedCosts <= 0);
+    if (!contextIsSumNegative(context, run.sumNegativeRedCosts - dualvalues[modeldata->nC - 1 + day])) {
+        *isComplete = TRUE;
+        return SCIP_OKAY;
+    }
+    /* compute the upper limit for a possible arrivaltime at each customer */
+    SCIP_CALL(threadAllocMemoryArray(&run.upperTimeWindows, modeldata->nC));
+    SCIP_CALL(getUpperTimeWindows(scip, modeldata, dualvalues, run.permutedNeighbors, run.npermutedNeighbors,
+                                  run.upperTimeWindows, day));
+    run.starttime = time(NULL);
+
+    /* the first customers of the tours are the tasks of the threads */
+    if (!isHeuristic && context->pool != NULL && getNIntraDayWorkers(context) > 1) {
+        SCIP_CALL(threadAllocMemoryArray(&run.roots, modeldata->nC));
+        SCIP_CALL(getRootCustomers(&run, arena, run.roots, &run.nroots));
+        nworkers = MAX(1, MIN(getNIntraDayWorkers(context), run.nroots));
+        /* the workers of the earlier rounds continue with their labels */
+        nworkers = MAX(nworkers, state->npools);
+    }
+    assert(nworkers <= state->maxpools);
+    run.nworkers = nworkers;
+
+    SCIP_CALL(threadAllocMemoryArray(&workers, nworkers));
+    if (run.roots == NULL) {
+        workers[0].run = &run;
+        workers[0].arena = arena;
+        workers[0].pool = &state->pools[0];
+        workers[0].bestLabels = bestLabels;
+        workers[0].repeatedNodes = repeatedNodes;
+        workers[0].keptLabels = NULL;
+        workers[0].nkeptLabels = 0;
+        workers[0].randomState = getRandomSeed(day, 0);
+        workers[0].nextRoot = 0;
+        workers[0].minRedCost = 0.0;
+        workers[0].isComplete = FALSE;
+        SCIP_CALL(propagateLabels(&run, &workers[0]));
+    } else {
+        threadGroupInit(&group);
+        for (i = 0; i < nworkers; i++) {
+            workers[i].run = &run;
+            workers[i].pool = &state->pools[i];
+            SCIP_CALL(labelArenaGetChild(scip, arena, i, &workers[i].arena));
+            SCIP_CALL(labelHeapCreate(scip, &workers[i].bestLabels));
+            SCIP_CALL(threadAllocClearMemoryArray(&workers[i].repeatedNodes, modeldata->nC / INT_BIT_SIZE + 1));
+            workers[i].keptLabels = NULL;
+            workers[i].nkeptLabels = 0;
+            workers[i].randomState = getRandomSeed(day, i);
+            workers[i].nextRoot = i;
+            workers[i].minRedCost = 0.0;
+            workers[i].isComplete = FALSE;
+        }
+        for (i = 0; i < nworkers; i++) {
+            SCIP_CALL(threadPoolSubmit(context->pool, &group, labelingWorkerTask, &workers[i]));
+        }
+        SCIP_CALL(threadPoolWait(context->pool, &group));
+        for (i = 0; i < nworkers; i++) {
+            for (r = i; r < MIN(workers[i].nextRoot, run.nroots); r += nworkers) {
+                state->isRootTaken[run.roots[r]] = TRUE;
+            }
+        }
+        /* collect the tours of the workers, their labels stay valid until arena is reset */
+        for (i = 0; i < nworkers; i++) {
+            while (workers[i].bestLabels->nentries > 0) {
+                SCIP_CALL(labelHeapInsert(scip, bestLabels, labelHeapExtractMin(workers[i].bestLabels)));
+            }
+            for (k = 0; k < modeldata->nC / INT_BIT_SIZE + 1; k++) {
+                repeatedNodes[k] |= workers[i].repeatedNodes[k];
+            }
+            threadFreeMemoryArray(&workers[i].repeatedNodes);
+            SCIP_CALL(labelHeapFree(scip, &workers[i].bestLabels));
+        }
+        threadFreeMemoryArray(&run.roots);
+    }
+    /* the labels of the workers are still in the arena, their paths seed the next round of this day */
+    if (run.warmstart != NULL) {
+        SCIP_CALL(updateWarmStart(&run, workers, nworkers));
+    }
+    /* the heuristic restrictions leave out tours, so they cannot prove the smallest reduced costs */
+    *isComplete = !isHeuristic && !HEURISTIC_DOMINANCE && !HEURISTIC_COLLECTABLE && !run.isTruncated;
+    for (i = 0; i < nworkers; i++) {
+        *minRedCost = MIN(*minRedCost, workers[i].minRedCost);
+        *isComplete = *isComplete && workers[i].isComplete;
+    }
+    threadFreeMemoryArray(&workers);
+    state->npools = MAX(state->npools, nworkers);
+
+    /* free memory, the labels and labellists stay in the arena, the neighbors are kept for the next round */
+    threadFreeMemoryArray(&run.upperTimeWindows);
+
+    return SCIP_OKAY;
+}
+
+/** returns TRUE if one of the customers of the tour is already visited */
+static
+SCIP_Bool tourHasVisitedCustomer(
+        int *tour,
+        int ncustomers,
+        SCIP_Bool *visited
+) {
+    int i;
+
+    for (i = 0; i < ncustomers; i++) {
+        if (visited[tour[i]]) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* add the best label(s) to the master problem, the visited nodes are built from the chain of parents.
+ * If visited is given, tours with an already visited customer are skipped, this happens if the days were labeled
+ * in parallel against the same visited customers. */
 static
 SCIP_RETCODE addToursToMaster(
         SCIP *scip,
         model_data *modeldata,
-        label_list **bestLabels,
+        label_heap *bestLabels,
         SCIP_Bool *visited,
         SCIP_Bool isFarkas,
         int day
 ) {
     int naddedLabels = 0;
-    int nbestLabels = labellistLength(*bestLabels);
+    int nbestLabels = bestLabels->nentries;
+    int *visitednodes;
+    int nvisitednodes;
 
     while (naddedLabels < MAX_ADDED_LABELS && nbestLabels > 0) {
         SCIP_PROBDATA *probdata = SCIPgetProbData(scip);
@@ -439,104 +1414,248 @@ SCIP_RETCODE addToursToMaster(
         int i;
         assert(bestLabels != NULL);
 
-        SCIP_CALL(labellistExtractFirst(scip, bestLabels, &newLabel));
+        newLabel = labelHeapExtractMin(bestLabels)->label;
         nbestLabels--;
 
+        nvisitednodes = newLabel->nvisitednodes;
+        SCIP_CALL(SCIPallocMemoryArray(scip, &visitednodes, nvisitednodes));
+        labelVrpGetPath(newLabel, visitednodes);
+
         /* double check, that the depot is the last visited node */
-        assert(newLabel->visitednodes[newLabel->nvisitednodes - 1] == modeldata->nC - 1);
+        assert(visitednodes[nvisitednodes - 1] == modeldata->nC - 1);
 
-        /* create variable name */
-        if (!isFarkas) {
-            (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "pricingLabelRed_%2d: ", newLabel->day);
-        } else {
-            (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "pricingLabelFar_%2d: ", newLabel->day);
-        }
-        for (i = 0; i < newLabel->nvisitednodes - 1; i++) {
-            (void) SCIPsnprintf(strtmp, SCIP_MAXSTRLEN, "_%d", newLabel->visitednodes[i]);
-            strcat(name, strtmp);
+        /* the customer was taken by a tour of an earlier day, try the next best tour of this day */
+        if (visited != NULL && tourHasVisitedCustomer(visitednodes, nvisitednodes - 1, visited)) {
+            SCIPfreeMemoryArray(scip, &visitednodes);
+            labelVrpFree(scip, &newLabel);
+            continue;
         }
 
-        /* Don't add the variable, if it is already contained in prob data*/
-        if (!SCIPprobdataContainsVar(probdata, name)) {
+        /* Don't add the variable, if its tour is already contained in prob data*/
+        if (!SCIPprobdataContainsTour(probdata, visitednodes, nvisitednodes - 1, day)) {
             /* create tour */
             SCIP_Bool isFeasible;
+            SCIP_Bool isContained = FALSE;
             solutionWindow **solutionwindows = NULL;
             int expectedDuration;
             int tourduration = newLabel->arrivaltimes[newLabel->narrivaltimes - 1] - newLabel->starttime;
-            double obj = computeObjValue(scip, modeldata, &solutionwindows, &isFeasible, newLabel->visitednodes,
-                                         &expectedDuration, newLabel->nvisitednodes - 1, day);
+            double obj = computeObjValue(scip, modeldata, &solutionwindows, &isFeasible, visitednodes,
+                                         &expectedDuration, nvisitednodes - 1, day);
             if (SCIPnodeGetNumber(SCIPgetCurrentNode(scip)) == 1) {
                 /* just for root node, since rearrangeTour does not respect branching decisions */
                 SCIP_CALL(
-                        rearrangeTour(scip, modeldata, newLabel->visitednodes, newLabel->nvisitednodes - 1, &obj, day));
+                        rearrangeTour(scip, modeldata, visitednodes, nvisitednodes - 1, &obj, day));
+                /* the rearranged tour can be the column of an earlier round */
+                isContained = SCIPprobdataContainsTour(probdata, visitednodes, nvisitednodes - 1, day);
             }
             assert(tourduration == expectedDuration);
             assert(isFeasible);
             assert(solutionwindows != NULL);
-            naddedLabels++;
+            if (!isContained) {
+                naddedLabels++;
 
-            /* safe visited customers for heuristic call */
-            if (visited != NULL) {
-                for (i = 0; i < newLabel->nvisitednodes - 1; i++) {
-                    visited[newLabel->visitednodes[i]] = TRUE;
+                /* safe visited customers for heuristic call */
+                if (visited != NULL) {
+                    for (i = 0; i < nvisitednodes - 1; i++) {
+                        visited[visitednodes[i]] = TRUE;
+                    }
+                }
+                /* create variable name, it is only built for new columns */
+                if (!isFarkas) {
+                    (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "pricingLabelRed_%2d: ", newLabel->day);
+                } else {
+                    (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "pricingLabelFar_%2d: ", newLabel->day);
                 }
+                for (i = 0; i < nvisitednodes - 1; i++) {
+                    (void) SCIPsnprintf(strtmp, SCIP_MAXSTRLEN, "_%d", visitednodes[i]);
+                    strcat(name, strtmp);
+                }
+                /* Add variable to model */
+                SCIP_CALL(SCIPcreateColumn(scip, probdata, name, FALSE, obj, visitednodes,
+                                           nvisitednodes - 1, expectedDuration, solutionwindows, day));
             }
-            /* Add variable to model */
-            SCIP_CALL(SCIPcreateColumn(scip, probdata, name, FALSE, obj, newLabel->visitednodes,
-                                       newLabel->nvisitednodes - 1, expectedDuration, solutionwindows, day));
-            SCIP_CALL(freeSolutionWindowArray(scip, solutionwindows, newLabel->nvisitednodes - 1));
+            SCIP_CALL(freeSolutionWindowArray(scip, solutionwindows, nvisitednodes - 1));
         }
 
         /* free memory */
+        SCIPfreeMemoryArray(scip, &visitednodes);
         labelVrpFree(scip, &newLabel);
     }
     return SCIP_OKAY;
 }
 
+/** Runs the labeling rounds with increasing neighborhood sizes until a tour with negative reduced costs is found.
+ *  minRedCost is lowered to the smallest reduced costs of the tours of the rounds, isProven is set to TRUE if one
+ *  round was complete. */
 static
-SCIP_RETCODE labelingAlgorithm(
+SCIP_RETCODE generateLabelsIncreasingNeighborhood(
         SCIP *scip,
-        SCIP_Bool isFarkas,        /**< TRUE for farkas-pricing, FALSE for redcost-pricing */
+        label_arena *arena,
+        pricing_context *context,
+        label_heap *bestLabels,
+        SCIP_Bool *visited,
         SCIP_Bool isHeuristic,
         int day,
-        SCIP_Bool *visited,
-        SCIP_Bool *toDepot,
-        label_list **bestLabels
+        sorted_neighbors *neighbors,
+        int *ngSets,
+        int *repeatedNodes,
+        completion_bound *completionBound,
+        double *minRedCost,
+        SCIP_Bool *isProven
 ) {
-    SCIP_PRICER *pricer = NULL;
-    SCIP_PRICERDATA *pricerdata = NULL;
-    model_data *modeldata = NULL;
-    double *dualvalues = NULL;
+    model_data *modeldata = context->modeldata;
+    labeling_state *state = NULL;             /* labels of the earlier rounds */
+    double roundRedCost;
+    SCIP_Bool isComplete;
     int nUsedNeighbors;
 
-    /* get the pricer, problem and model data */
-    assert(scip != NULL);
-    pricer = SCIPfindPricer(scip, "vrp");
-    assert(pricer != NULL);
-    pricerdata = SCIPpricerGetData(pricer);
-    assert(pricerdata != NULL);
-    modeldata = pricerdata->modeldata;
-    assert(modeldata != NULL);
-    assert(modeldata->nC - 1 + modeldata->nDays == pricerdata->nconss);
-    assert((isHeuristic && (visited != NULL)) || (!isHeuristic && (visited == NULL)));
-
-    /* get dual/farkas values */
-    SCIP_CALL(SCIPallocMemoryArray(scip, &dualvalues, pricerdata->nconss));
-    SCIP_CALL(getDualValues(scip, dualvalues, isFarkas));
-
     /* increase the neighborhood size in each iteration */
     nUsedNeighbors = (40 <= modeldata->day_sizes[day] ? 40 : modeldata->day_sizes[day]);
     if (!isHeuristic) {
         nUsedNeighbors = (20 <= modeldata->day_sizes[day] ? 20 : modeldata->day_sizes[day]);
     }
-    /* generate labels with negative reduced costs and save them in bestLabels */
-    while (*bestLabels == NULL && nUsedNeighbors <= modeldata->day_sizes[day]) {
+    /* without tours, no label of an earlier call is referenced anymore, the labels of all rounds are kept */
+    if (bestLabels->nentries == 0) {
+        labelArenaReset(arena);
+    }
+    SCIP_CALL(createLabelingState(context, &state));
+    /* generate labels with negative reduced costs and save them in bestLabels, the neighbors that were sorted in
+     * one round stay sorted for the next, larger rounds and the labels only get the propagations that were missing */
+    while (bestLabels->nentries == 0 && nUsedNeighbors <= modeldata->day_sizes[day]) {
         nUsedNeighbors *= 2;
-        SCIP_CALL(generateLabels(scip, modeldata, bestLabels, dualvalues, visited, isFarkas, isHeuristic, day,
-                                 nUsedNeighbors, toDepot));
+        SCIP_CALL(generateLabels(scip, arena, context, bestLabels, visited, isHeuristic, day, neighbors, state,
+                                 nUsedNeighbors, ngSets, repeatedNodes, completionBound, &roundRedCost, &isComplete));
+        *minRedCost = MIN(*minRedCost, roundRedCost);
+        *isProven = *isProven || isComplete;
+    }
+    SCIP_CALL(freeLabelingState(scip, modeldata->nC, &state));
+
+    return SCIP_OKAY;
+}
+
+/** returns TRUE if no bit of the bit array is set */
+static
+SCIP_Bool bitArrayIsEmpty(
+        int *bitArray,
+        int sizeBitarray
+) {
+    int k;
+
+    for (k = 0; k < sizeBitarray; k++) {
+        if (bitArray[k] != 0) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/** Decremental state-space relaxation: the labels only remember their visits of critical customers. The critical set
+ *  is passed to generateLabels as the ng-neighborhood of every customer, it starts empty and the customers that are
+ *  visited twice by the rejected tours of a round are added to it. The rounds are repeated until an elementary tour
+ *  is found or no tour has a cycle. Every round is a relaxation, so its complete rounds bound the reduced costs. */
+static
+SCIP_RETCODE generateLabelsDSSR(
+        SCIP *scip,
+        label_arena *arena,
+        pricing_context *context,
+        label_heap *bestLabels,
+        int day,
+        sorted_neighbors *neighbors,
+        int sizeBitarray,
+        int *repeatedNodes,
+        completion_bound *completionBound,
+        double *minRedCost,
+        SCIP_Bool *isProven
+) {
+    model_data *modeldata = context->modeldata;
+    int *criticalSets = NULL;                 /* the critical set, once for each customer */
+    int i;
+    int k;
+
+    SCIP_CALL(threadAllocClearMemoryArray(&criticalSets, (modeldata->nC - 1) * sizeBitarray));
+    while (TRUE) {
+        for (k = 0; k < sizeBitarray; k++) {
+            repeatedNodes[k] = 0;
+        }
+        SCIP_CALL(generateLabelsIncreasingNeighborhood(scip, arena, context, bestLabels, NULL, FALSE, day,
+                                                       neighbors, criticalSets, repeatedNodes, completionBound,
+                                                       minRedCost, isProven));
+        if (bestLabels->nentries > 0 || bitArrayIsEmpty(repeatedNodes, sizeBitarray)) {
+            break;
+        }
+        /* a critical customer is never visited twice, so the critical set grows in each round */
+        SCIPdebugMessage("day %d: DSSR round with new critical customers\n", day);
+        for (i = 0; i < modeldata->nC - 1; i++) {
+            for (k = 0; k < sizeBitarray; k++) {
+                criticalSets[i * sizeBitarray + k] |= repeatedNodes[k];
+            }
+        }
     }
+    threadFreeMemoryArray(&criticalSets);
 
-    SCIPfreeMemoryArray(scip, &dualvalues);
+    return SCIP_OKAY;
+}
+
+/** runs the labeling algorithm for one day, the labels of bestLabels are located in the given arena.
+ *  All data of the pricing call is read from the context, so it can run on a thread of the pool.
+ *  minRedCost is set to the smallest negative reduced costs of the tours of the day, also of the tours that are
+ *  rejected or already contained in the master problem, or 0 if there is none. If isProven is set to TRUE, no tour of
+ *  the day has smaller reduced costs. */
+static
+SCIP_RETCODE labelingAlgorithm(
+        SCIP *scip,
+        label_arena *arena,
+        pricing_context *context,
+        SCIP_Bool isHeuristic,
+        int day,
+        SCIP_Bool *visited,
+        label_heap *bestLabels,
+        double *minRedCost,
+        SCIP_Bool *isProven
+) {
+    model_data *modeldata = context->modeldata;
+    int *ngSets = NULL;
+    int *repeatedNodes = NULL;                /* customers that are visited twice by a rejected tour */
+    completion_bound *completionBound = NULL;
+    sorted_neighbors *neighbors = NULL;       /* neighbors sorted by the dual values of this pricing call */
+    int sizeBitarray;
+
+    assert(scip != NULL);
+    assert(modeldata != NULL);
+    assert((isHeuristic && (visited != NULL)) || (!isHeuristic && (visited == NULL)));
+
+    *minRedCost = 0.0;
+    *isProven = FALSE;
+    sizeBitarray = modeldata->nC / INT_BIT_SIZE + 1;
+    SCIP_CALL(threadAllocClearMemoryArray(&repeatedNodes, sizeBitarray));
+    SCIP_CALL(createSortedNeighbors(scip, context, day, &neighbors));
+    if (COMPLETION_BOUNDS && !isHeuristic) {
+        SCIP_CALL(completionBoundCreate(scip, context, &completionBound, day));
+    }
+
+    if (DSSR_LABELING && !isHeuristic) {
+        SCIP_CALL(generateLabelsDSSR(scip, arena, context, bestLabels, day, neighbors, sizeBitarray,
+                                     repeatedNodes, completionBound, minRedCost, isProven));
+    } else {
+        if (NG_ROUTE_RELAXATION && !isHeuristic) {
+            SCIP_CALL(getNgNeighborhoods(scip, modeldata, day, sizeBitarray, &ngSets));
+        }
+        SCIP_CALL(generateLabelsIncreasingNeighborhood(scip, arena, context, bestLabels, visited, isHeuristic, day,
+                                                       neighbors, ngSets, repeatedNodes, completionBound, minRedCost,
+                                                       isProven));
+        /* the ng-route relaxation only found tours with cycles, search for elementary tours instead */
+        if (bestLabels->nentries == 0 && !bitArrayIsEmpty(repeatedNodes, sizeBitarray)) {
+            SCIPdebugMessage("day %d: no elementary ng-route, labeling is repeated with elementary labels\n", day);
+            SCIP_CALL(generateLabelsIncreasingNeighborhood(scip, arena, context, bestLabels, visited, isHeuristic,
+                                                           day, neighbors, NULL, repeatedNodes, completionBound,
+                                                           minRedCost, isProven));
+        }
+    }
+
+    completionBoundFree(scip, &completionBound);
+    freeSortedNeighbors(scip, modeldata->nC, &neighbors);
+    threadFreeMemoryArray(&repeatedNodes);
+    threadFreeMemoryArrayNull(&ngSets);
     return SCIP_OKAY;
 }
 
@@ -548,87 +1667,123 @@ SCIP_RETCODE labelingAlgorithmIterativ(
         int nDays,
         tuple *days,
         SCIP_Bool *visited,
-        SCIP_Bool *toDepot
+        SCIP_Bool *toDepot,
+        double *minRedCosts,
+        SCIP_Bool *isProven
 ) {
-    label_list *bestLabels = NULL;
+    pricing_context *context = NULL;
+    label_heap *bestLabels = NULL;
+    label_arena *arena = NULL;
+    double minRedCost;
+    SCIP_Bool isDayProven;
     int i;
+
+    SCIP_CALL(pricingContextCreate(scip, &context, isFarkas, toDepot));
+    SCIP_CALL(labelArenaCreate(scip, &arena, LABEL_ARENA_CHUNKSIZE));
+    SCIP_CALL(labelHeapCreate(scip, &bestLabels));
     for (i = 0; i < nDays; i++) {
-        labelingAlgorithm(scip, isFarkas, isHeuristic, days[i].index, visited, toDepot, &bestLabels);
+        SCIP_CALL(labelingAlgorithm(scip, arena, context, isHeuristic, days[i].index, visited, bestLabels,
+                                    &minRedCost, &isDayProven));
+        if (minRedCosts != NULL) {
+            minRedCosts[days[i].index] = minRedCost;
+            isProven[days[i].index] = isDayProven;
+        }
 
-        SCIP_CALL(addToursToMaster(scip, SCIPgetProbData(scip)->modeldata, &bestLabels, visited, isFarkas,
+        SCIP_CALL(addToursToMaster(scip, SCIPgetProbData(scip)->modeldata, bestLabels, visited, isFarkas,
                                    days[i].index));
-        SCIP_CALL(labellistDestroy(scip, bestLabels));
-        bestLabels = NULL;
+        /* the remaining best labels are part of the arena */
+        labelHeapClear(bestLabels);
+        labelArenaReset(arena);
     }
+    SCIP_CALL(labelHeapFree(scip, &bestLabels));
+    SCIP_CALL(labelArenaFree(scip, &arena));
+    pricingContextFree(scip, &context);
 
     return SCIP_OKAY;
 }
 
+/** runs the labeling of one day as a task of the thread pool */
 static
-void *labeling_thread(void *arguments) {
+SCIP_RETCODE labelingDayTask(void *arguments) {
     arg_struct *args = arguments;
     int day = args->day;
 
     assert(args != NULL);
-    assert(!args->isHeuristic && args->visited == NULL);
+    assert(args->isHeuristic == (args->visited != NULL));
 
-    labelingAlgorithm(args->scip, args->isFarkas, args->isHeuristic, day, args->visited, args->toDepot,
-                      &args->bestLabels);
+    SCIP_CALL(labelingAlgorithm(args->scip, args->arena, args->context, args->isHeuristic, day, args->visited,
+                                args->bestLabels, &args->minRedCost, &args->isProven));
 
     if (PRINT_EXACT_LABELING) {
-        printf("Thread for day %d: Ended.\n", day);
+        printf("Task for day %d: Ended.\n", day);
     }
 
-    return NULL;
+    return SCIP_OKAY;
 }
 
-/** Same as labeling Algorithm, but uses a different thread for each day */
+/** Same as labeling Algorithm, but runs the days as tasks of the thread pool of the pricer.
+ *  In heuristic labeling, all days are labeled against the visited customers at the start. Afterwards, the tours are
+ *  added in the order of days, a tour that visits a customer of a tour of an earlier day is replaced by the next best
+ *  tour of its day. */
 SCIP_RETCODE labelingAlgorithmParallel(
         SCIP *scip,
         SCIP_Bool isFarkas,        /**< TRUE for farkas-pricing, FALSE for redcost-pricing */
         SCIP_Bool isHeuristic,
         int nDays,
+        tuple *days,
         SCIP_Bool *visited,
-        SCIP_Bool *toDepot
+        SCIP_Bool *toDepot,
+        double *minRedCosts,
+        SCIP_Bool *isProven
 ) {
-    pthread_t threads[nDays];
+    pricing_context *context = NULL;
     arg_struct *thread_args;
-    int result_code;
+    thread_group group;
     int i;
 
-    SCIP_CALL(SCIPallocMemoryArray(scip, &thread_args, nDays));
+    /* the duals and the pricer data are read once, the tasks of the days share them */
+    SCIP_CALL(pricingContextCreate(scip, &context, isFarkas, toDepot));
+    assert(context->pool != NULL);
+
+    SCIP_CALL(threadAllocMemoryArray(&thread_args, nDays));
+    threadGroupInit(&group);
 
     if (PRINT_EXACT_LABELING) {
         printf("Starting Labeling Algorithm in Parallel.\n");
     }
-    //create all threads one by one
+    //submit all days one by one
     for (i = 0; i < nDays; i++) {
         thread_args[i].scip = scip;
-        thread_args[i].isFarkas = isFarkas;
+        thread_args[i].context = context;
         thread_args[i].isHeuristic = isHeuristic;
         thread_args[i].day = i;
         thread_args[i].visited = visited;
-        thread_args[i].toDepot = toDepot;
-        thread_args[i].bestLabels = NULL;
+        SCIP_CALL(labelHeapCreate(scip, &thread_args[i].bestLabels));
+        SCIP_CALL(labelArenaCreate(scip, &thread_args[i].arena, LABEL_ARENA_CHUNKSIZE));
 
-        result_code = pthread_create(&threads[i], NULL, labeling_thread, &thread_args[i]);
-        assert(!result_code);
+        SCIP_CALL(threadPoolSubmit(context->pool, &group, labelingDayTask, &thread_args[i]));
     }
 
-    //wait for each thread to complete
+    //wait for each day to complete, this thread runs queued tasks in the meantime
+    SCIP_CALL(threadPoolWait(context->pool, &group));
+
+    /* add the best labels as tours of each day to the master problem, conflicts are resolved in the order of days */
     for (i = 0; i < nDays; i++) {
-        result_code = pthread_join(threads[i], NULL);
-        assert(!result_code);
+        int day = (days != NULL ? days[i].index : i);
+        SCIP_CALL(addToursToMaster(scip, SCIPgetProbData(scip)->modeldata, thread_args[day].bestLabels, visited,
+                                   isFarkas, day));
     }
-
-    /* add the best labels as tours of each day to the master problem */
     for (i = 0; i < nDays; i++) {
-        SCIP_CALL(addToursToMaster(scip, SCIPgetProbData(scip)->modeldata, &(thread_args[i].bestLabels), visited,
-                                   isFarkas, i));
-        SCIP_CALL(labellistDestroy(scip, thread_args[i].bestLabels));
+        if (minRedCosts != NULL) {
+            minRedCosts[i] = thread_args[i].minRedCost;
+            isProven[i] = thread_args[i].isProven;
+        }
+        SCIP_CALL(labelHeapFree(scip, &thread_args[i].bestLabels));
+        SCIP_CALL(labelArenaFree(scip, &thread_args[i].arena));
     }
 
-    SCIPfreeMemoryArray(scip, &thread_args);
+    threadFreeMemoryArray(&thread_args);
+    pricingContextFree(scip, &context);
 
     return SCIP_OKAY;
 }
@@ -1,11 +1,14 @@
 /**@file   labellist_vrp.c
- * @brief  sorted list with labels, so that labels are picked in specified order (e.g. smallest reduced costs)
+ * @brief  nodes of the label tree, the labels are picked from heaps in specified order (e.g. smallest reduced costs)
  * @author Tim Niemann, TU Braunschweig
  */
 
 #include "scip/scip.h"
 #include "labellist_vrp.h"
+#include "labelindex_vrp.h"
+#include "labelheap_vrp.h"
 #include "label_vrp.h"
+#include "threadmemory_vrp.h"
 
 /** Free labellist data */
 SCIP_RETCODE labellistFree(
@@ -17,7 +20,12 @@ SCIP_RETCODE labellistFree(
     assert(list != NULL);
     if (*list != NULL)
     {
-        SCIPfreeMemory(scip, list);
+        if ((*list)->arena != NULL)
+        {
+            labelArenaRelease((*list)->arena, *list, sizeof(label_list));
+        } else {
+            threadFreeMemory(list);
+        }
         *list = NULL;
     }
 
@@ -37,183 +45,27 @@ SCIP_RETCODE labellistCreate(
     assert(*list == NULL);
     assert(label != NULL);
 
-    SCIP_CALL( SCIPallocMemory(scip, list) );
+    if (label->arena != NULL)
+    {
+        SCIP_CALL( labelArenaAlloc(scip, label->arena, (void**) list, sizeof(label_list)) );
+    } else {
+        SCIP_CALL( threadAllocMemory(list) );
+    }
 
+    (*list)->arena = label->arena;
     (*list)->label = label;
     (*list)->value = value;
-    (*list)->next = NULL;
-    (*list)->prev = NULL;
     (*list)->nextSibling = NULL;
     (*list)->prevSibling = NULL;
     (*list)->parent = NULL;
     (*list)->child = NULL;
     (*list)->isPropagated = FALSE;
-    
-    return SCIP_OKAY;
-}
-
-/** Destroys a label list, i.e. free every attached labellist */
-SCIP_RETCODE labellistDestroy(
-    SCIP*                   scip,
-    label_list*             list
-    )
-{
-    label_list* tmp;
-
-    assert(scip != NULL);
-    
-    while(list != NULL) 
-    {
-        tmp = list->next;
-        labelVrpFree(scip, &(list->label));
-        labellistFree(scip, &list);
-        list = tmp;
-    }
-
-    return SCIP_OKAY;
-}
-
-/** Inserts a label into a labellist */
-SCIP_RETCODE labellistInsert(
-    SCIP*                   scip,
-    label_list**            list, 
-    labelVrp*               label,
-    double                  value
-    ) 
-{
-    label_list* newNode;
-    label_list* tmp;
-    assert(label != NULL);
-
-    if (*list == NULL)
-    {
-        SCIP_CALL( labellistCreate(scip, list, label, value));
-        assert(*list != NULL);
-        return SCIP_OKAY;
-    }
-    
-    newNode = NULL;
-    assert(*list != NULL);
-    assert((*list)->label != label);
-    SCIP_CALL( labellistCreate(scip, &newNode, label, value));
-    assert(newNode != NULL);
-
-    /* Insert at the start, set new head node */
-    if ((*list)->value >= value)
-    {
-        newNode->next = *list;
-        *list = newNode;
-        return SCIP_OKAY;
-    }
-    tmp = *list;
-    while (tmp->next != NULL)
-    {
-        if (tmp->next->value < value)
-        {
-            tmp = tmp->next;
-        /* Insertion in the middle */
-        } else {
-            assert(tmp->value <= value);
-            assert(value <= tmp->next->value);
-            newNode->next = tmp->next;
-            tmp->next = newNode;
-            return SCIP_OKAY;
-        }
-    }
-    /* Insertion at the end */
-    assert(tmp->next == NULL);
-    assert(tmp->value < value);
-
-    tmp->next = newNode;
-    assert((*list)->next != (*list));
-    
-    return SCIP_OKAY;
-}
-
-/** Inserts a label into a labellist and save its address */
-SCIP_RETCODE labellistInsertNew(
-        SCIP*                   scip,
-        label_list**            list,
-        labelVrp*               label,
-        label_list**            newNode,
-        double                  value
-)
-{
-    label_list* tmp;
-    assert(label != NULL);
-
-    /* heuristic ordering, results in modified depth search with less stagnation */
-    value = value + 0.1 * label->collactableRedcost;
-    if (*list == NULL)
-    {
-        if(*newNode == NULL)
-        {
-            SCIP_CALL(labellistCreate(scip, list, label, value));
-            *newNode = *list;
-        }else{
-            *list = *newNode;
-        }
-        assert(*list != NULL);
-        return SCIP_OKAY;
-    }
-
-    assert(*list != NULL);
-    assert((*list)->label != label);
-    if(*newNode == NULL)
-    {
-        SCIP_CALL(labellistCreate(scip, newNode, label, value));
-    }
-    assert(*newNode != NULL);
-
-    /* Insert at the start, set new head node */
-    if ((*list)->value >= value)
-    {
-        (*newNode)->next = *list;
-        (*list)->prev = *newNode;
-        *list = *newNode;
-        return SCIP_OKAY;
-    }
-    tmp = *list;
-    while (tmp->next != NULL)
-    {
-        if (tmp->next->value < value)
-        {
-            tmp = tmp->next;
-        } else {
-            /* Insertion in the middle */
-            assert(tmp->value <= value);
-            assert(value <= tmp->next->value);
-            (*newNode)->next = tmp->next;
-            (*newNode)->prev = tmp;
-            tmp->next->prev = *newNode;
-            tmp->next = *newNode;
-            return SCIP_OKAY;
-        }
-    }
-    /* Insertion at the end */
-    assert(tmp->next == NULL);
-    assert(tmp->value < value);
-
-    (*newNode)->prev = tmp;
-    tmp->next = *newNode;
-    assert((*list)->next != (*list));
-    return SCIP_OKAY;
-}
-
-/** Removes and gets first element of labellist */
-SCIP_RETCODE labellistExtractFirst(
-    SCIP*                   scip, 
-    label_list**            list,
-    labelVrp**              label
-    ) 
-{
-    label_list* tmp = *list;
-    assert(*list != NULL);
-    assert(*label == NULL);
-
-    *label = (*list)->label;
-    *list = (*list)->next;
-    labellistFree(scip, &tmp);
+    (*list)->bucket = NULL;
+    (*list)->bucketpos = -1;
+    (*list)->heappos = -1;
+    (*list)->order = 0;
+    (*list)->nextNeighbor = 0;
+    (*list)->npropagated = 0;
 
     return SCIP_OKAY;
 }
@@ -240,40 +92,22 @@ SCIP_RETCODE deleteFromFamilyTree(
     return SCIP_OKAY;
 }
 
-
-/** deletes labellist from customer labellist */
-static
-SCIP_RETCODE deleteFromLabelList(
-        label_list**        allLists,
-        label_list*         list
-        ){
-    if(list->prev == NULL)
-    {
-        if(list->next != NULL) {
-            list->next->prev = NULL;
-        }
-        *allLists = list->next;
-    }else{
-        list->prev->next = list->next;
-        if(list->next != NULL)
-        {
-            list->next->prev = list->prev;
-        }
-    }
-    return SCIP_OKAY;
-}
-
 /** deletes labellist references */
 static
 SCIP_RETCODE deleteList(
         SCIP*               scip,
-        label_list**        allLists,
+        label_index*        index,
+        label_heap*         heap,
         label_list*         list
         ){
     assert(list != NULL);
 
     deleteFromFamilyTree(list);
-    deleteFromLabelList(allLists, list);
+    if (heap != NULL)
+    {
+        labelHeapRemove(heap, list);
+    }
+    labelIndexRemove(index, list);
 
     labelVrpFree(scip, &(list->label));
     labellistFree(scip, &list);
@@ -285,8 +119,8 @@ SCIP_RETCODE deleteList(
 static
 SCIP_RETCODE deleteChildren(
         SCIP*              scip,
-        label_list**       activeLabels,
-        label_list**       oldLabels,
+        label_index*       index,
+        label_heap*        openLabels,
         label_list*        list,
         int*               deletedLabels,
         int*               nUsedLabels
@@ -296,16 +130,23 @@ SCIP_RETCODE deleteChildren(
         label_list* child = list->child;
         while(child != NULL)
         {
-            deleteChildren(scip, activeLabels, oldLabels, child, deletedLabels, nUsedLabels);
+            deleteChildren(scip, index, openLabels, child, deletedLabels, nUsedLabels);
 
             child = list->child;
         }
         nUsedLabels[list->label->node]--;
-        deleteList(scip, &oldLabels[list->label->node], list);
+        /* a propagated label that was opened again for a larger neighborhood is also an active label */
+        if(list->heappos >= 0)
+        {
+            deleteList(scip, index, &openLabels[list->label->node], list);
+            (*deletedLabels)++;
+        }else{
+            deleteList(scip, index, NULL, list);
+        }
 
         return SCIP_OKAY;
     }else{
-        deleteList(scip, &activeLabels[list->label->node], list);
+        deleteList(scip, index, &openLabels[list->label->node], list);
         (*deletedLabels)++;
 
         return SCIP_OKAY;
@@ -313,99 +154,103 @@ SCIP_RETCODE deleteChildren(
 }
 
 /**
- * Checks if this labels dominates a label in the list or vice versa
- * @param scip scip instance
- * @param list list with all other labels
- * @param label new label to be checked for dominance
- * @return -1 if this label is dominated by a label in the list, 
- *          0 if there is no dominance relation to other labels,
- *          1 if this label dominates a label already in the list */
-int labellistDominanceCheck(
+ * Checks if a new label is dominated by an active or propagated label at its node, or if it dominates some of them.
+ * Only the buckets of the index are compared, which can contain a dominating or dominated label. */
+SCIP_RETCODE labellistDominanceCheck(
     SCIP*                   scip,
-    label_list**            activeLabels,
-    label_list**            oldLabels,
+    label_index*            index,
+    label_heap*             openLabels,
     labelVrp*               label,
-    SCIP_Bool               usedlabels,
+    SCIP_Bool*              isDominated,
     int*                    deletedLabels,
     int*                    nUsedLabels
     )
 {
-    label_list *tmplist;
-    label_list *nextlist;
-    int i = 0;
-
+    label_bucket* buckets;
+    label_bucket* ownBucket;
+    int isDominatedInBlock[LABEL_INDEX_BLOCKSIZE];
+    int blockstart;
+    int b;
+    int j;
+
+    assert(index != NULL);
     assert(label != NULL);
+    assert(isDominated != NULL);
+    assert(deletedLabels != NULL);
 
-    if(!usedlabels)
+    *isDominated = FALSE;
+    buckets = &index->buckets[label->node * index->nbuckets];
+    ownBucket = labelIndexGetBucket(index, label->node, label->arrivaltimes[0]);
+    labelIndexSetProbe(index, label);
+
+    /* a dominating label arrives not later and has not higher reduced costs */
+    for (b = 0; b < index->nbuckets; b++)
     {
-        tmplist = activeLabels[label->node];
-    }else{
-        tmplist = oldLabels[label->node];
+        label_bucket* bucket = &buckets[b];
+        if (bucket > ownBucket || SCIPisSumPositive(scip, bucket->minRedcost - label->redcost))
+        {
+            index->nskipped += bucket->nentries;
+            continue;
+        }
+        if (labelIndexFindDominating(index, bucket) >= 0)
+        {
+            *isDominated = TRUE;
+            return SCIP_OKAY;
+        }
     }
 
-    while (tmplist != NULL)
+    /* a dominated label arrives not earlier and has not lower reduced costs */
+    for (b = 0; b < index->nbuckets; b++)
     {
-        nextlist = tmplist->next;
-        /* a member of the list dominates the new label */
-        if (labelVrpDominates(scip, tmplist->label, label))
+        label_bucket* bucket = &buckets[b];
+        if (bucket < ownBucket || SCIPisSumPositive(scip, label->redcost - bucket->maxRedcost))
         {
-            assert(i == 0);
-            return -1;
+            index->nskipped += bucket->nentries;
+            continue;
         }
-        /* or the new label dominates a member of the list, delete the already contained one */
-        else if (labelVrpDominates(scip, label, tmplist->label))
+        /* blocks and labels are processed backwards, so a deleted label is replaced by one that was already checked */
+        for (blockstart = ((bucket->nentries - 1) / LABEL_INDEX_BLOCKSIZE) * LABEL_INDEX_BLOCKSIZE; blockstart >= 0;
+             blockstart -= LABEL_INDEX_BLOCKSIZE)
         {
-            if(!usedlabels)
+            labelIndexGetDominated(index, bucket, blockstart, isDominatedInBlock);
+            for (j = LABEL_INDEX_BLOCKSIZE - 1; j >= 0; j--)
             {
-                i++;
-                deleteList(scip, &activeLabels[label->node], tmplist);
-            }else{
-                /* delete all descendants of tmplist */
-                SCIP_CALL( deleteChildren(scip, activeLabels, oldLabels, tmplist, deletedLabels, nUsedLabels) );
+                label_list* list;
+                int nentries;
+                if (!isDominatedInBlock[j] || blockstart + j >= bucket->nentries)
+                {
+                    continue;
+                }
+                list = bucket->entries[blockstart + j];
+                nentries = bucket->nentries;
+                if (!list->isPropagated)
+                {
+                    SCIP_CALL( deleteList(scip, index, &openLabels[label->node], list) );
+                    (*deletedLabels)++;
+                }else{
+                    /* delete all descendants of list */
+                    SCIP_CALL( deleteChildren(scip, index, openLabels, list, deletedLabels, nUsedLabels) );
+                    /* a descendant at this node can be removed from the bucket as well, which moves other labels to
+                     * the unchecked positions of this block */
+                    if (bucket->nentries < nentries - 1 && blockstart < bucket->nentries)
+                    {
+                        labelIndexGetDominated(index, bucket, blockstart, isDominatedInBlock);
+                    }
+                }
             }
         }
-        tmplist = nextlist;
     }
 
-    return i;
-}
-
-void labellistPrint(
-    label_list*             list
-    ) 
-{    
-    while (list != NULL)
-    {
-        labelVrpPrint(list->label);
-        assert(list->next != list);
-        list = list->next;
-    }
+    return SCIP_OKAY;
 }
 
+/** Prints the visited nodes of the label of a labellist */
 void labellistPrintFirstShort(
     label_list*             list
     )
 {
-    int i;
     if (list != NULL)
     {
-        for (i = 0; i < list->label->nvisitednodes; i++)
-        {
-            printf("%d->", list->label->visitednodes[i]);
-        }
-        printf("\n");
+        labelVrpPrintPath(list->label);
     }
 }
-
-int labellistLength(
-    label_list*         list
-    )
-{
-    int i = 0;
-    while(list != NULL)
-    {
-        list = list->next;
-        i++;
-    }
-    return i;
-}
\ No newline at end of file
@@ -282,151 +282,48 @@ SCIP_RETCODE setArcMatrix(
     return SCIP_OKAY;
 }
 
-/** Sets up neighborhood at the current branching node */
+/** Sets up neighborhood at the current branching node, a compacted copy of the neighbor graph of the model data */
 static
 SCIP_RETCODE setCurrentNeighborhood(
         SCIP*                   scip,
         SCIP_PRICERDATA*        pricerData,
         model_data*             modelData
 ){
-    int i, j;
-    neighbor* nb;
-    neighbor* newnb;
-    neighbor* lastnb;
-    SCIP_CALL( SCIPallocBlockMemory(scip, &newnb) );
+    neighbor_graph* graph = pricerData->neighborGraph;
+    neighbor_graph* modelGraph = modelData->neighborGraph;
+    int i, j, k;
 
-    /* create current neighborhood */
-    for(i = 0; i < modelData->nC - 1; i++)
+    assert(graph != NULL);
+    assert(modelGraph != NULL);
+
+    /* create current neighborhood, the depot is the last node */
+    clearNeighborGraph(graph);
+    for(i = 0; i < modelData->nC; i++)
     {
         for(j = 0; j < modelData->nDays; j++)
         {
-            assert(pricerData->neighbors[i][j] == NULL);
             /* if customer is not available, skip day */
-            if(!pricerData->timetable[i][j])
+            if(i != modelData->nC - 1 && !pricerData->timetable[i][j])
                 continue;
 
-            lastnb = NULL;
-            nb = modelData->neighbors[i][j];
             /* copy from modeldata but skip forbidden neighbors */
-            while(nb != NULL)
+            for(k = neighborGraphBegin(modelGraph, i, j); k < neighborGraphEnd(modelGraph, i, j); k++)
             {
+                int head = neighborGraphHead(modelGraph, k);
+
                 /* if neighbor is not available on day, skip */
-                if(!pricerData->timetable[nb->id][j])
-                {
-                    nb = nb->next;
+                if(!pricerData->timetable[head][j])
                     continue;
-                }
                 /* if arc is forbidden, skip */
-                if(pricerData->isForbidden[i][nb->id])
-                {
-                    nb = nb->next;
+                if(pricerData->isForbidden[i][head])
                     continue;
-                }
-
-                newnb->id = nb->id;
-                newnb->next = NULL;
-                if(lastnb == NULL)
-                {
-                    pricerData->neighbors[i][j] = newnb;
-                    lastnb = newnb;
-                }
-                else
-                {
-                    lastnb->next = newnb;
-                    lastnb = newnb;
-                }
-                SCIP_CALL( SCIPallocBlockMemory(scip, &newnb) );
 
-                nb = nb->next;
+                addNeighborGraphArc(graph, i, j, head);
             }
         }
     }
-    /* special case - depot */
-    i = modelData->nC - 1;
-    for(j = 0; j < modelData->nDays; j++)
-    {
-        assert(pricerData->neighbors[i][j] == NULL);
-        lastnb = NULL;
-        nb = modelData->neighbors[i][j];
-        while(nb != NULL)
-        {
-            /* if neighbor is not available on day, skip */
-            if(!pricerData->timetable[nb->id][j])
-            {
-                nb = nb->next;
-                continue;
-            }
-            /* if arc is forbidden, skip */
-            if(pricerData->isForbidden[i][nb->id])
-            {
-                nb = nb->next;
-                continue;
-            }
-
-            newnb->id = nb->id;
-            newnb->next = NULL;
-            if(lastnb == NULL)
-            {
-                pricerData->neighbors[i][j] = newnb;
-                lastnb = newnb;
-            }
-            else
-            {
-                lastnb->next = newnb;
-                lastnb = newnb;
-            }
-            SCIP_CALL( SCIPallocBlockMemory(scip, &newnb) );
-
-            nb = nb->next;
-        }
-    }
-    SCIPfreeBlockMemory(scip, &newnb);
+    finishNeighborGraph(graph);
 
-//    assert(FALSE);
-    return SCIP_OKAY;
-}
-
-/** Clears the neighborhood at the current node */
-static
-SCIP_RETCODE clearNeighbors(
-        SCIP*              scip,
-        SCIP_PRICERDATA*   pricerdata
-)
-{
-    int i, j;
-    neighbor* nb;
-
-    assert(pricerdata != NULL);
-    assert(pricerdata->neighbors != NULL);
-
-    /* clear old neighborhood */
-    if(pricerdata->lastnodeid != 1)
-    {
-        for(i = 0; i < pricerdata->nC; i++)
-        {
-            assert(pricerdata->neighbors[i] != NULL);
-
-            for(j = 0; j < pricerdata->nDays; j++)
-            {
-                while(pricerdata->neighbors[i][j] != NULL)
-                {
-                    nb = pricerdata->neighbors[i][j];
-                    pricerdata->neighbors[i][j] = pricerdata->neighbors[i][j]->next;
-                    SCIPfreeBlockMemory(scip, &nb);
-                }
-            }
-        }
-    }
-    else
-    {
-        for(i = 0; i < pricerdata->modeldata->nC; i++)
-        {
-            for(j = 0; j < pricerdata->modeldata->nDays; j++)
-            {
-                pricerdata->neighbors[i][j] = NULL;
-            }
-        }
-    }
     return SCIP_OKAY;
 }
 
@@ -455,10 +352,6 @@ SCIP_RETCODE set_current_graph(
     /* set up enforced customers based on timetable */
     SCIP_CALL(setEnforcedCustomers(scip, pricerData, modelData));
 
-//    printf("Clear Neighbors\n");
-    /* clear old neighborhood */
-    SCIP_CALL(clearNeighbors(scip, pricerData));
-
 //    printf("Set New Neighborhoods \n");
     /* get neighborhood based on branching decisions */
     SCIP_CALL(setCurrentNeighborhood(scip, pricerData, modelData));
@@ -500,13 +393,12 @@ SCIP_RETCODE getCurrentNeighborhood(
     int ncons;
     int tail, head;
     CONSTYPE type;
-    neighbor* nb;
-    neighbor* newnb;
-    neighbor* lastnb;
+    neighbor_graph* graph;
+    neighbor_graph* modelGraph;
 
     int* successor;
     int* predecessor;
-    int i, j;
+    int i, j, k;
 
     assert( pricerdata != NULL );
 
@@ -519,23 +411,11 @@ SCIP_RETCODE getCurrentNeighborhood(
 
     SCIP_CALL( SCIPallocBlockMemoryArray(scip, &successor, modeldata->nC) );
     SCIP_CALL( SCIPallocBlockMemoryArray(scip, &predecessor, modeldata->nC) );
-    SCIP_CALL( SCIPallocBlockMemory(scip, &newnb) );
 
-    /* clear old neighborhood */
-    if(pricerdata->lastnodeid != 1)
-    {
-        clearNeighbors(scip, pricerdata);
-    }
-    else
-    {
-        for(i = 0; i < pricerdata->modeldata->nC; i++)
-        {
-            for(j = 0; j < pricerdata->modeldata->nDays; j++)
-            {
-                pricerdata->neighbors[i][j] = NULL;
-            }
-        }
-    }
+    graph = pricerdata->neighborGraph;
+    modelGraph = modeldata->neighborGraph;
+    assert(graph != NULL);
+    assert(modelGraph != NULL);
 
     /* safe prohibited and enforced arcs */
     for(i = 0; i < modeldata->nC; i++)
@@ -616,50 +496,28 @@ SCIP_RETCODE getCurrentNeighborhood(
     }
 
     /* create current neighborhood */
+    clearNeighborGraph(graph);
     for(i = 0; i < modeldata->nC - 1; i++)
     {
         for(j = 0; j < modeldata->nDays; j++)
         {
-            assert(pricerdata->neighbors[i][j] == NULL);
-
             /* if customer i has an enforced outgoing arc only set one neighbor */
             if(successor[i] != -1)
             {
-                newnb->id = successor[i];
-                newnb->next = NULL;
-                pricerdata->neighbors[i][j] = newnb;
-                SCIP_CALL( SCIPallocBlockMemory(scip, &newnb) );
+                addNeighborGraphArc(graph, i, j, successor[i]);
                 continue;
             }
-            else
+            /* copy from modeldata but skip forbidden neighbors */
+            for(k = neighborGraphBegin(modelGraph, i, j); k < neighborGraphEnd(modelGraph, i, j); k++)
             {
-                lastnb = NULL;
-                nb = modeldata->neighbors[i][j];
-                /* copy from modeldata but skip forbidden neighbors */
-                while(nb != NULL)
+                int head = neighborGraphHead(modelGraph, k);
+
+                if(pricerdata->isForbidden[i][head] || predecessor[head] != -1)
                 {
-                    if(pricerdata->isForbidden[i][nb->id] || predecessor[nb->id] != -1)
-                    {
-                        assert(predecessor[nb->id] != i);
-                    }
-                    else
-                    {
-                        newnb->id = nb->id;
-                        newnb->next = NULL;
-                        if(lastnb == NULL)
-                        {
-                            pricerdata->neighbors[i][j] = newnb;
-                            lastnb = newnb;
-                        }
-                        else
-                        {
-                            lastnb->next = newnb;
-                            lastnb = newnb;
-                        }
-                        SCIP_CALL( SCIPallocBlockMemory(scip, &newnb) );
-                    }
-                    nb = nb->next;
+                    assert(predecessor[head] != i);
+                    continue;
                 }
+                addNeighborGraphArc(graph, i, j, head);
             }
         }
     }
@@ -667,38 +525,18 @@ SCIP_RETCODE getCurrentNeighborhood(
     i = modeldata->nC - 1;
     for(j = 0; j < modeldata->nDays; j++)
     {
-        assert(pricerdata->neighbors[i][j] == NULL);
-        lastnb = NULL;
-        nb = modeldata->neighbors[i][j];
-        while(nb != NULL)
+        for(k = neighborGraphBegin(modelGraph, i, j); k < neighborGraphEnd(modelGraph, i, j); k++)
         {
-            if(pricerdata->isForbidden[i][nb->id] || (predecessor[nb->id] != i && predecessor[nb->id] != -1))
+            int head = neighborGraphHead(modelGraph, k);
+
+            if(pricerdata->isForbidden[i][head] || (predecessor[head] != i && predecessor[head] != -1))
             {
-                nb = nb->next;
                 continue;
             }
-            else
-            {
-                newnb->id = nb->id;
-                newnb->next = NULL;
-                if(lastnb == NULL)
-                {
-                    pricerdata->neighbors[i][j] = newnb;
-                    lastnb = newnb;
-                }
-                else
-                {
-                    lastnb->next = newnb;
-                    lastnb = newnb;
-                }
-                SCIP_CALL( SCIPallocBlockMemory(scip, &newnb) );
-            }
-            nb = nb->next;
+            addNeighborGraphArc(graph, i, j, head);
         }
-
     }
-
-    SCIPfreeBlockMemory(scip, &newnb);
+    finishNeighborGraph(graph);
 
     SCIPfreeBlockMemoryArray(scip, &predecessor, modeldata->nC);
     SCIPfreeBlockMemoryArray(scip, &successor, modeldata->nC);
@@ -728,17 +566,9 @@ SCIP_DECL_PRICERFREE(pricerFreeVrp)
       /* free memory */
       SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->conss, pricerdata->nconss);
       SCIPfreeBlockMemoryArrayNull(scip, &pricerdata->toDepot, pricerdata->nC - 1);
-       if(pricerdata->neighbors != NULL)
+       if(pricerdata->neighborGraph != NULL)
        {
-           if(pricerdata->lastnodeid > 1)
-           {
-               clearNeighbors(scip, pricerdata);
-           }
-           for(int i = 0; i < pricerdata->nC; i++)
-           {
-               SCIPfreeBlockMemoryArray(scip, &pricerdata->neighbors[i], pricerdata->nDays);
-           }
-           SCIPfreeBlockMemoryArray(scip, &pricerdata->neighbors, pricerdata->nC);
+           freeNeighborGraph(scip, &pricerdata->neighborGraph);
        }
        for(int i = 0; i < pricerdata->nC; i++)
        {
@@ -749,6 +579,21 @@ SCIP_DECL_PRICERFREE(pricerFreeVrp)
        SCIPfreeBlockMemoryArray(scip, &pricerdata->timetable, pricerdata->nC);
        SCIPfreeBlockMemoryArray(scip, &pricerdata->eC, pricerdata->nC);
        SCIPfreeBlockMemoryArray(scip, &pricerdata->nEC, pricerdata->nDays);
+       if( pricerdata->warmstart != NULL )
+       {
+          warmStartFree(scip, &pricerdata->warmstart);
+       }
+       if( pricerdata->stabilization != NULL )
+       {
+          dualStabilizationFree(scip, &pricerdata->stabilization);
+       }
+       SCIP_CALL( threadPoolFree(scip, &pricerdata->pool) );
+       /* the free lists of all threads are kept until the pricer is freed, each one up to THREAD_MEMORY_MAXCACHED bytes */
+       if( PRINT_EXACT_LABELING )
+       {
+          threadMemoryPrintStatistics(scip);
+       }
+       threadMemoryFreeAll();
 
       SCIPfreeBlockMemory(scip, &pricerdata);
    }
@@ -810,6 +655,11 @@ SCIP_DECL_PRICEREXITSOL(pricerExitsolVrp)
       SCIP_CALL( SCIPreleaseCons(scip, &(pricerdata->conss[c])) );
    }
 
+   if( pricerdata->stabilization != NULL )
+   {
+      dualStabilizationPrintStatistics(scip, pricerdata->stabilization);
+   }
+
    return SCIP_OKAY;
 }
 
@@ -822,6 +672,9 @@ SCIP_DECL_PRICERREDCOST(pricerRedcostVrp)
    SCIP_PRICERDATA* pricerdata = SCIPpricerGetData(pricer);
    SCIP_PROBDATA* probdata = SCIPgetProbData(scip);
    SCIP_Bool* visited;
+   double* duals = NULL;
+   double* minRedCosts = NULL;
+   SCIP_Bool* isProven = NULL;
    int i;
    int nvars;
 
@@ -849,6 +702,11 @@ SCIP_DECL_PRICERREDCOST(pricerRedcostVrp)
 //        SCIP_CALL( getCurrentNeighborhood(scip, pricerdata) );
 
         pricerdata->lastnodeid = SCIPnodeGetNumber(SCIPgetCurrentNode(scip));
+        /* the dual values of the last node are no good center */
+        if( pricerdata->stabilization != NULL )
+        {
+           dualStabilizationReset(pricerdata->stabilization);
+        }
     }
 
     /* run primal heuristic, if we found a better LP-solution since last call */
@@ -891,8 +749,14 @@ SCIP_DECL_PRICERREDCOST(pricerRedcostVrp)
    /* Sort the tuples by dualvalue, days with large dualvalue come first because this result in smaller reduced costs */
    qsort(days, pricerdata->modeldata->nDays, sizeof(days[0]), cmp_vrp);
 
-   /* first try to find a tour with some heuristics */
-   SCIP_CALL( labelingAlgorithmIterativ(scip, FALSE, TRUE, pricerdata->modeldata->nDays, days, visited, pricerdata->toDepot) );
+   /* first try to find a tour with some heuristics, they use the true dual values, because only columns with negative
+    * reduced costs in the current LP help */
+   if (PARALLEL_HEURISTIC_LABELING)
+   {
+      SCIP_CALL( labelingAlgorithmParallel(scip, FALSE, TRUE, pricerdata->modeldata->nDays, days, visited, pricerdata->toDepot, NULL, NULL) );
+   } else {
+      SCIP_CALL( labelingAlgorithmIterativ(scip, FALSE, TRUE, pricerdata->modeldata->nDays, days, visited, pricerdata->toDepot, NULL, NULL) );
+   }
 
    SCIPfreeBlockMemoryArray(scip, &visited, pricerdata->modeldata->nC - 1);
    /* Success? */
@@ -910,12 +774,31 @@ SCIP_DECL_PRICERREDCOST(pricerRedcostVrp)
    {
       printf("Reduced cost pricing: Heuristic unsuccessful, trying exact pricing now.\n");
    }
-   if (PARALLEL_LABELING)
+   /* the exact labeling of this round prices with the smoothed dual values */
+   if( pricerdata->stabilization != NULL )
    {
-      SCIP_CALL( labelingAlgorithmParallel(scip, FALSE, FALSE, pricerdata->modeldata->nDays, NULL, pricerdata->toDepot) );
-   } else {
-      SCIP_CALL( labelingAlgorithmIterativ(scip, FALSE, FALSE, pricerdata->modeldata->nDays, days, NULL, pricerdata->toDepot) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &duals, pricerdata->nconss) );
+      SCIP_CALL( getDualValues(scip, duals, FALSE) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &minRedCosts, pricerdata->modeldata->nDays) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &isProven, pricerdata->modeldata->nDays) );
+      dualStabilizationStartRound(pricerdata->stabilization, duals);
+   }
+   /* a misprice of the smoothed dual values is repeated with the true ones, only they can prove optimality */
+   do
+   {
+      if (PARALLEL_LABELING)
+      {
+         SCIP_CALL( labelingAlgorithmParallel(scip, FALSE, FALSE, pricerdata->modeldata->nDays, NULL, NULL, pricerdata->toDepot, minRedCosts, isProven) );
+      } else {
+         SCIP_CALL( labelingAlgorithmIterativ(scip, FALSE, FALSE, pricerdata->modeldata->nDays, days, NULL, pricerdata->toDepot, minRedCosts, isProven) );
+      }
    }
+   while( pricerdata->stabilization != NULL
+      && dualStabilizationEndRound(pricerdata->stabilization, nvars < SCIPgetNVars(scip), minRedCosts, isProven,
+         pricerdata->modeldata->nDays, duals) );
+   SCIPfreeBlockMemoryArrayNull(scip, &isProven, pricerdata->modeldata->nDays);
+   SCIPfreeBlockMemoryArrayNull(scip, &minRedCosts, pricerdata->modeldata->nDays);
+   SCIPfreeBlockMemoryArrayNull(scip, &duals, pricerdata->nconss);
 
    if(SCIPgetSolvingTime(scip) >= 3600 && nvars == SCIPgetNVars(scip))
    {
@@ -988,7 +871,12 @@ SCIP_DECL_PRICERFARKAS(pricerFarkasVrp)
    }
 
    /* first try to find a tour with some heuristics */
-   SCIP_CALL( labelingAlgorithmIterativ(scip, TRUE, TRUE, pricerdata->modeldata->nDays, days, visited, pricerdata->toDepot) );
+   if (PARALLEL_HEURISTIC_LABELING)
+   {
+      SCIP_CALL( labelingAlgorithmParallel(scip, TRUE, TRUE, pricerdata->modeldata->nDays, days, visited, pricerdata->toDepot, NULL, NULL) );
+   } else {
+      SCIP_CALL( labelingAlgorithmIterativ(scip, TRUE, TRUE, pricerdata->modeldata->nDays, days, visited, pricerdata->toDepot, NULL, NULL) );
+   }
 
    SCIPfreeBlockMemoryArray(scip, &visited, pricerdata->modeldata->nC - 1);
    /* success? */
@@ -1007,7 +895,12 @@ SCIP_DECL_PRICERFARKAS(pricerFarkasVrp)
    for (i = 0; i < pricerdata->modeldata->nDays; i++)
    {
       nvars = SCIPgetNVars(scip);
-      SCIP_CALL( labelingAlgorithmIterativ(scip, TRUE, FALSE, pricerdata->modeldata->nDays, days, NULL, pricerdata->toDepot) );
+      if (PARALLEL_LABELING)
+      {
+         SCIP_CALL( labelingAlgorithmParallel(scip, TRUE, FALSE, pricerdata->modeldata->nDays, days, NULL, pricerdata->toDepot, NULL, NULL) );
+      } else {
+         SCIP_CALL( labelingAlgorithmIterativ(scip, TRUE, FALSE, pricerdata->modeldata->nDays, days, NULL, pricerdata->toDepot, NULL, NULL) );
+      }
    }
 
    if(SCIPgetSolvingTime(scip) >= 3600 && nvars == SCIPgetNVars(scip))
@@ -1044,11 +937,16 @@ SCIP_RETCODE SCIPincludePricerVrp(
 
    assert(pricerdata->conshdlr != NULL);
    pricerdata->lastnodeid = 1;
-   pricerdata->neighbors = NULL;
+   pricerdata->neighborGraph = NULL;
    pricerdata->toDepot = NULL;
    pricerdata->nC = 0;
    pricerdata->nDays = 0;
    pricerdata->lastLPVal = DBL_MAX;
+   pricerdata->warmstart = NULL;
+   pricerdata->stabilization = NULL;
+
+   /* start the threads of the exact labeling, they wait for tasks until the pricer is freed */
+   SCIP_CALL( threadPoolCreate(scip, &pricerdata->pool, LABELING_THREADS) );
 
    /* include variable pricer */
    SCIP_CALL( SCIPincludePricerBasic(scip, &pricer, PRICER_NAME, PRICER_DESC, PRICER_PRIORITY, PRICER_DELAY,
@@ -1072,7 +970,7 @@ SCIP_RETCODE SCIPpricerVrpActivate(
 {
    SCIP_PRICER* pricer;
    SCIP_PRICERDATA* pricerdata;
-   int i, c;
+   int i, j, k, c;
 
    assert(scip != NULL);
    assert(conss != NULL);
@@ -1087,11 +985,22 @@ SCIP_RETCODE SCIPpricerVrpActivate(
 
    /* copy arrays */
    SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &pricerdata->conss, conss, nconss) );
-   SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &pricerdata->neighbors, modeldata->neighbors, modeldata->nC) );
+   /* the local neighborhood starts as a copy of the neighbor graph, an enforced arc can add one arc per customer and day */
+   assert(modeldata->neighborGraph != NULL);
+   SCIP_CALL( createNeighborGraph(scip, &pricerdata->neighborGraph, modeldata->nC, modeldata->nDays,
+         modeldata->neighborGraph->narcs + modeldata->nC * modeldata->nDays) );
+   clearNeighborGraph(pricerdata->neighborGraph);
    for(i = 0; i < modeldata->nC; i++)
    {
-       SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(pricerdata->neighbors[i]), modeldata->neighbors[i], modeldata->nDays) );
+       for(j = 0; j < modeldata->nDays; j++)
+       {
+           for(k = neighborGraphBegin(modeldata->neighborGraph, i, j); k < neighborGraphEnd(modeldata->neighborGraph, i, j); k++)
+           {
+               addNeighborGraphArc(pricerdata->neighborGraph, i, j, neighborGraphHead(modeldata->neighborGraph, k));
+           }
+       }
    }
+   finishNeighborGraph(pricerdata->neighborGraph);
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &pricerdata->toDepot, modeldata->nC - 1) );
    for(i = 0; i < modeldata->nC - 1; i++)
    {
@@ -1146,6 +1055,18 @@ SCIP_RETCODE SCIPpricerVrpActivate(
         }
     }
 
+   /* the exact labeling of each day keeps the paths of its best labels for the next pricing round */
+   if( WARM_START_LABELING )
+   {
+      SCIP_CALL( warmStartCreate(scip, &pricerdata->warmstart, pricerdata->nDays, WARM_START_LABELS,
+            pricerdata->nC - 1) );
+   }
+
+   if( DUAL_STABILIZATION )
+   {
+      SCIP_CALL( dualStabilizationCreate(scip, &pricerdata->stabilization, nconss, DUAL_SMOOTHING_FACTOR) );
+   }
+
    /* activate pricer */
    SCIP_CALL( SCIPactivatePricer(scip, pricer) );
 
@@ -1210,10 +1131,11 @@ double sumOfPossibleDualvalues(
     )
 {
     SCIP_PROBDATA* probdata = SCIPgetProbData(scip);
-    modelWindow* window;
-    neighbor* node;
+    window_table* table = modeldata->windowTable;
+    neighbor_graph* graph = modeldata->neighborGraph;
     double possibleDualValue;
     int i;
+    int k;
 
     assert(modeldata != NULL);
     assert(dualvalues != NULL);
@@ -1221,13 +1143,12 @@ double sumOfPossibleDualvalues(
 
     possibleDualValue = 0;
     /* if the instance is preprocessed, the customers of this day are exactly the neighbors of the depot */
-    if (modeldata->neighbors != NULL)
+    if (graph != NULL)
     {
-        node = modeldata->neighbors[modeldata->nC - 1][day];
-        while(node != NULL)
+        for (k = neighborGraphBegin(graph, modeldata->nC - 1, day); k < neighborGraphEnd(graph, modeldata->nC - 1, day); k++)
         {
             int hardCustomerBonus = 0;
-            i = node->id;
+            i = neighborGraphHead(graph, k);
             /* Price Collecting for hard customers */
             if (probdata->useOptionals == TRUE && probdata->optionalCustomers[i] == TRUE)
             {
@@ -1235,11 +1156,9 @@ double sumOfPossibleDualvalues(
             }
             if (!SCIPisSumPositive(scip, dualvalues[i] + hardCustomerBonus))
             {
-                node = node->next;
                 continue;
             }
             possibleDualValue += dualvalues[i] + hardCustomerBonus;
-            node = node->next;
         }
     /* if the instance is not preprocessed, the customers of this day are searched manually */
     } else {
@@ -1255,15 +1174,10 @@ double sumOfPossibleDualvalues(
             {
                 continue;
             }
-            window = modeldata->timeWindows[i];
-            while (window != NULL)
+            /* the customer can be visited on this day if it has a time window on this day */
+            if (windowTableEnd(table, i, day) > windowTableBegin(table, i, day))
             {
-                if (window->day == day)
-                {
-                    possibleDualValue += dualvalues[i] + hardCustomerBonus;
-                    break;
-                }
-                window = window->next;
+                possibleDualValue += dualvalues[i] + hardCustomerBonus;
             }
         }
     }
@@ -349,16 +349,16 @@ SCIP_Bool investigateColumn(
     if(improvement) // tour with negative reduced costs has been found!
     {
         assert(tourLength > 0);
+        if (SCIPprobdataContainsTour(probdata, tour, tourLength, day)) // check if corresponding column already exists - happens due to aging
+        {
+            return FALSE;
+        }
         (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "pricingLocSearch_%2d: ", day);
         for (i = 0; i < tourLength; i++)
         {
             (void) SCIPsnprintf(strtmp, SCIP_MAXSTRLEN, "_%d", tour[i]);
             strcat(name, strtmp);
         }
-        if (SCIPprobdataContainsVar(probdata, name)) // check if corresponding column already exists - happens due to aging
-        {
-            return FALSE;
-        }
         /* safe new tour */
         *newtourobj = obj;
         *newtourlength = tourLength;
@@ -494,6 +494,11 @@ SCIP_RETCODE localSearchPricing(
     }
     for(j = 0; j < addedCols; j++) // add each new column/tour to the model
     {
+        /* two investigated columns can lead to the same tour */
+        if (SCIPprobdataContainsTour(probdata, newtours[j], newtourslength[j], newtours[j][newtourslength[j]]))
+        {
+            continue;
+        }
         solutionwindows = NULL;
         tmpobj = computeObjValue(scip, modeldata, &solutionwindows, &isfeasible, newtours[j], &duration, newtourslength[j], newtours[j][newtourslength[j]]);
         assert(tmpobj == newtoursobj[j]);
@@ -0,0 +1,94 @@
+/**@file   pricingcontext_vrp.c
+ * @brief  read-only snapshot of the data of one pricing call, shared by all labeling threads
+ * @author Lukas Schürmann, University Bonn
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "scip/scip.h"
+
+#include "pricingcontext_vrp.h"
+#include "tools_vrp.h"
+#include "probdata_vrp.h"
+#include "pricer_vrp.h"
+
+/**
+ * Interface functions
+ */
+
+/** Creates the context of a pricing call */
+extern
+SCIP_RETCODE pricingContextCreate(
+    SCIP*           scip,
+    pricing_context** context,
+    SCIP_Bool       isFarkas,
+    SCIP_Bool*      toDepot
+    )
+{
+    SCIP_PROBDATA* probdata = SCIPgetProbData(scip);
+    SCIP_PRICERDATA* pricerdata = SCIPpricerGetData(SCIPfindPricer(scip, "vrp"));
+    model_data* modeldata;
+    int day;
+
+    assert(scip != NULL);
+    assert(context != NULL);
+    assert(probdata != NULL);
+    assert(pricerdata != NULL);
+    assert(toDepot != NULL);
+
+    modeldata = pricerdata->modeldata;
+    assert(modeldata->nC - 1 + modeldata->nDays == pricerdata->nconss);
+
+    SCIP_CALL( SCIPallocMemory(scip, context) );
+    (*context)->modeldata = modeldata;
+    (*context)->isFarkas = isFarkas;
+    (*context)->alphas[0] = probdata->alphas[0];
+    (*context)->alphas[1] = probdata->alphas[1];
+    (*context)->alphas[2] = probdata->alphas[2];
+    (*context)->delayTolerance = probdata->delayTolerance;
+    (*context)->shortestEdge = probdata->shortestEdge;
+    (*context)->useOptionals = probdata->useOptionals;
+    (*context)->optionalCustomers = probdata->optionalCustomers;
+    (*context)->neighborGraph = pricerdata->neighborGraph;
+    (*context)->isForbidden = pricerdata->isForbidden;
+    (*context)->eC = pricerdata->eC;
+    (*context)->nEC = pricerdata->nEC;
+    (*context)->toDepot = toDepot;
+    (*context)->sumepsilon = SCIPsumepsilon(scip);
+    (*context)->deadline = time(NULL) + (time_t) (SOLVING_TIME_LIMIT - SCIPgetSolvingTime(scip));
+    (*context)->pool = pricerdata->pool;
+    (*context)->warmstart = pricerdata->warmstart;
+
+    /* get dual/farkas values */
+    SCIP_CALL( SCIPallocMemoryArray(scip, &(*context)->dualvalues, pricerdata->nconss) );
+    SCIP_CALL( getDualValues(scip, (*context)->dualvalues, isFarkas) );
+    if (!isFarkas && pricerdata->stabilization != NULL && pricerdata->stabilization->isSmoothed)
+    {
+        memcpy((*context)->dualvalues, pricerdata->stabilization->duals, pricerdata->nconss * sizeof(double));
+    }
+
+    SCIP_CALL( SCIPallocMemoryArray(scip, &(*context)->possibleDualvalues, modeldata->nDays) );
+    for (day = 0; day < modeldata->nDays; day++)
+    {
+        (*context)->possibleDualvalues[day] = sumOfPossibleDualvalues(scip, modeldata, (*context)->dualvalues, day,
+                                                                      isFarkas);
+    }
+
+    return SCIP_OKAY;
+}
+
+/** Frees the context of a pricing call */
+extern
+void pricingContextFree(
+    SCIP*           scip,
+    pricing_context** context
+    )
+{
+    assert(context != NULL);
+    assert(*context != NULL);
+
+    SCIPfreeMemoryArray(scip, &(*context)->possibleDualvalues);
+    SCIPfreeMemoryArray(scip, &(*context)->dualvalues);
+    SCIPfreeMemory(scip, context);
+}
@@ -27,6 +27,7 @@ SCIP_RETCODE dispatchingHeuristic(
     model_data* modeldata;              // underlying modeldata
     tuple* valonday;                    // values of the day variables
     SCIP_VAR** modelvars;               // current variables
+    SCIP_VAR* var;                      // variable of an already contained tour
     SCIP_VARDATA* vardata;              // data of the variables
     SCIP_Real lpval;                    // value of the variable in the current solution
     int nvars;                          // number of variables in the current LP
@@ -135,6 +136,13 @@ SCIP_RETCODE dispatchingHeuristic(
             {
                 if (tourlength[day] > 0)
                 {
+                    /* a tour that is already contained in the master problem is taken from its variable */
+                    var = SCIPprobdataGetTourVar(probdata, tour[day], tourlength[day], day);
+                    if (var != NULL)
+                    {
+                        SCIP_CALL( SCIPsetSolVal(scip, solution, var, 1.0) );
+                        continue;
+                    }
                     newvars++;
                     (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "%s_%2d: ", "primalDispatch", day);
                     for (i = 0; i < tourlength[day]; i++)
@@ -148,7 +156,9 @@ SCIP_RETCODE dispatchingHeuristic(
                     assert(isfeasible);
                     SCIP_CALL( SCIPcreateColumn(scip, probdata, name, TRUE, tourobj[day], tour[day], tourlength[day], duration, solutionwindows[day], day));
                     SCIP_CALL( freeSolutionWindowArray(scip, solutionwindows[day], tourlength[day]) );
-                    SCIP_CALL( SCIPsetSolVal(scip, solution, probdata->vars[probdata->nvars - 1], 1.0) );
+                    var = SCIPprobdataGetTourVar(probdata, tour[day], tourlength[day], day);
+                    assert(var != NULL);
+                    SCIP_CALL( SCIPsetSolVal(scip, solution, var, 1.0) );
                 }else
                 {
                     (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "t_initEmpty_%2d", day);
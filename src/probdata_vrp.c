@@ -55,6 +55,41 @@ SCIP_DECL_EVENTEXEC(eventExecAddedVar)
  * @{
  */
 
+/** gets the key of a variable in the tour table, the variable data contains its day and tour */
+static
+SCIP_DECL_HASHGETKEY(hashGetKeyTour)
+{
+   return SCIPvarGetData((SCIP_VAR*) elem);
+}
+
+/** returns TRUE if two variable data describe the same tour on the same day */
+static
+SCIP_DECL_HASHKEYEQ(hashKeyEqTour)
+{
+   SCIP_VARDATA* vardata1 = (SCIP_VARDATA*) key1;
+   SCIP_VARDATA* vardata2 = (SCIP_VARDATA*) key2;
+
+   if( vardata1->day != vardata2->day || vardata1->tourlength != vardata2->tourlength )
+      return FALSE;
+   return vardata1->tourlength == 0
+      || memcmp(vardata1->customertour, vardata2->customertour, vardata1->tourlength * sizeof(int)) == 0;
+}
+
+/** returns the hash value of the day and sequence of customers of a variable data */
+static
+SCIP_DECL_HASHKEYVAL(hashKeyValTour)
+{
+   SCIP_VARDATA* vardata = (SCIP_VARDATA*) key;
+   uint64_t hashval = (uint64_t) vardata->day;
+   int i;
+
+   for( i = 0; i < vardata->tourlength; i++ )
+   {
+      hashval = hashval * 0x9e3779b97f4a7c15ULL + (uint64_t) vardata->customertour[i] + 1;
+   }
+   return hashval;
+}
+
 /** creates problem data */
 static
 SCIP_RETCODE probdataCreate(
@@ -87,6 +122,10 @@ SCIP_RETCODE probdataCreate(
    /* duplicate arrays */
    SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &(*probdata)->conss, conss, nconss) );
 
+   /* the variables are inserted when they are final, i.e. after they were transformed */
+   SCIP_CALL( SCIPhashtableCreate(&(*probdata)->tourtable, SCIPblkmem(scip), MAX(100, 2 * nvars), hashGetKeyTour,
+         hashKeyEqTour, hashKeyValTour, NULL) );
+
    (*probdata)->modeldata = modeldata;
    (*probdata)->nvars = nvars;
    (*probdata)->varssize = nvars;
@@ -129,6 +168,7 @@ SCIP_RETCODE probdataFree(
       SCIP_CALL( SCIPreleaseCons(scip, &(*probdata)->conss[i]) );
    }
    /* free memory of arrays */
+   SCIPhashtableFree(&(*probdata)->tourtable);
    SCIPfreeBlockMemoryArray(scip, &(*probdata)->alphas, 3);
    SCIPfreeBlockMemoryArray(scip, &(*probdata)->vars, (*probdata)->varssize);
    SCIPfreeBlockMemoryArray(scip, &(*probdata)->conss, (*probdata)->nconss);
@@ -162,6 +202,8 @@ SCIP_DECL_PROBDELORIG(probdelorigVrp)
 static
 SCIP_DECL_PROBTRANS(probtransVrp)
 {
+   int i;
+
    /* create transform probdata */
    SCIP_CALL( probdataCreate(scip, targetdata, sourcedata->vars, sourcedata->conss, 
          sourcedata->nvars, sourcedata->nconss, sourcedata->modeldata, sourcedata->delayTolerance, sourcedata->alphas, sourcedata->optionalCustomers) );
@@ -173,6 +215,16 @@ SCIP_DECL_PROBTRANS(probtransVrp)
    /* transform all variables */
    SCIP_CALL( SCIPtransformVars(scip, (*targetdata)->nvars, (*targetdata)->vars, (*targetdata)->vars) );
 
+   /* the transformed variables share the variable data of the original ones; the first variable of a tour is its
+    * representative */
+   for( i = 0; i < (*targetdata)->nvars; ++i )
+   {
+      if( SCIPhashtableRetrieve((*targetdata)->tourtable, SCIPvarGetData((*targetdata)->vars[i])) == NULL )
+      {
+         SCIP_CALL( SCIPhashtableInsert((*targetdata)->tourtable, (*targetdata)->vars[i]) );
+      }
+   }
+
    return SCIP_OKAY;
 }
 
@@ -367,35 +419,62 @@ SCIP_RETCODE SCIPprobdataAddVar(
    probdata->vars[probdata->nvars] = var;
    probdata->nvars++;
 
+   /* only a new tour is inserted, a variable with an equal tour that was added before stays its representative */
+   assert(SCIPvarGetData(var) != NULL);
+   if( SCIPhashtableRetrieve(probdata->tourtable, SCIPvarGetData(var)) == NULL )
+   {
+      SCIP_CALL( SCIPhashtableInsert(probdata->tourtable, var) );
+   }
+
    SCIPdebugMsg(scip, "added variable to probdata; nvars = %d\n", probdata->nvars);
 
    return SCIP_OKAY;
 }
 
 /**
- * Check by name, if a potential new variable was already added to the master problem
- * @param name variable name to check
+ * Find the variable of a tour in the master problem
  * @param probdata problem data which contains all previously generated variables
- * @return TRUE, if this variable is already contained in the master problem;
- *         FALSE, if this varibale name is not found */
+ * @return the first variable that was added with this day and sequence of customers;
+ *         NULL, if this tour is not found */
 extern
-SCIP_Bool SCIPprobdataContainsVar(
+SCIP_VAR* SCIPprobdataGetTourVar(
    SCIP_PROBDATA*        probdata,           /**< problem data */
-   const char*           name                /**< variables name to check */
+   int*                  tour,               /**< sequence of visited customers (without depot) */
+   int                   tourlength,         /**< number of visited customers */
+   int                   day                 /**< day of the tour */
    )
 {
-   int i;
+   SCIP_VARDATA key;
    assert(probdata != NULL);
-   assert(name != NULL);
+   assert(tour != NULL || tourlength == 0);
+
+   /* only the day and the tour are compared */
+   key.day = day;
+   key.customertour = tour;
+   key.tourlength = tourlength;
+   return (SCIP_VAR*) SCIPhashtableRetrieve(probdata->tourtable, &key);
+}
+
+/**
+ * Check by its tour, if a potential new variable was already added to the master problem
+ * @param probdata problem data which contains all previously generated variables
+ * @return TRUE, if a variable with this day and sequence of customers is already contained in the master problem;
+ *         FALSE, if this tour is not found */
+extern
+SCIP_Bool SCIPprobdataContainsTour(
+   SCIP_PROBDATA*        probdata,           /**< problem data */
+   int*                  tour,               /**< sequence of visited customers (without depot) */
+   int                   tourlength,         /**< number of visited customers */
+   int                   day                 /**< day of the tour */
+   )
+{
+   SCIP_VAR* var;
 
-   for (i = 0; i < probdata->nvars; i++)
+   var = SCIPprobdataGetTourVar(probdata, tour, tourlength, day);
+   if (var != NULL)
    {
-      const char* tempname = SCIPvarGetName(probdata->vars[i]);
-      if (strcmp(name, tempname) == 0)
-      {
-         SCIPdebugMessage("Tried to add variable that is already contained in master problem: %s\n", name);
-         return TRUE;
-      }
+      SCIPdebugMessage("Tried to add variable that is already contained in master problem: %s\n", SCIPvarGetName(var));
+      return TRUE;
    }
    return FALSE;
 }
@@ -0,0 +1,215 @@
+/**@file   stabilization_vrp.c
+ * @brief  Wentges smoothing of the dual values of reduced cost pricing
+ * @author Lukas Schürmann, University Bonn
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "scip/scip.h"
+#include "stabilization_vrp.h"
+
+/**
+ * Local functions
+ */
+
+/** returns a lower bound on the Lagrangian bound of the dual values of the round, -infinity if the smallest reduced
+ *  costs of a day are not proven */
+static
+double getLagrangianBound(
+    dual_stabilization* stabilization,
+    double*         minRedCosts,
+    SCIP_Bool*      isProven,
+    int             nDays
+    )
+{
+    double bound = 0.0;
+    int i;
+
+    for (i = 0; i < nDays; i++)
+    {
+        if (!isProven[i])
+        {
+            return -SCIP_DEFAULT_INFINITY;
+        }
+        assert(minRedCosts[i] <= 0.0);
+        bound += minRedCosts[i];
+    }
+    for (i = 0; i < stabilization->nconss; i++)
+    {
+        bound += stabilization->duals[i];
+    }
+    return bound;
+}
+
+/**
+ * Interface functions
+ */
+
+/** Creates the stabilization, the first round uses the true dual values */
+extern
+SCIP_RETCODE dualStabilizationCreate(
+    SCIP*           scip,
+    dual_stabilization** stabilization,
+    int             nconss,
+    double          alpha
+    )
+{
+    assert(scip != NULL);
+    assert(stabilization != NULL);
+    assert(nconss > 0);
+    assert(0.0 <= alpha && alpha < 1.0);
+
+    SCIP_CALL( SCIPallocMemory(scip, stabilization) );
+    SCIP_CALL( SCIPallocMemoryArray(scip, &(*stabilization)->center, nconss) );
+    SCIP_CALL( SCIPallocMemoryArray(scip, &(*stabilization)->duals, nconss) );
+    (*stabilization)->nconss = nconss;
+    (*stabilization)->alpha = alpha;
+    (*stabilization)->centerBound = -SCIP_DEFAULT_INFINITY;
+    (*stabilization)->hasCenter = FALSE;
+    (*stabilization)->isSmoothed = FALSE;
+    (*stabilization)->nrounds = 0;
+    (*stabilization)->nsmoothed = 0;
+    (*stabilization)->nsmoothedSuccess = 0;
+    (*stabilization)->nmisprices = 0;
+    (*stabilization)->ncenterUpdates = 0;
+
+    return SCIP_OKAY;
+}
+
+/** Frees the stabilization */
+extern
+void dualStabilizationFree(
+    SCIP*           scip,
+    dual_stabilization** stabilization
+    )
+{
+    assert(stabilization != NULL);
+    assert(*stabilization != NULL);
+
+    SCIPfreeMemoryArray(scip, &(*stabilization)->duals);
+    SCIPfreeMemoryArray(scip, &(*stabilization)->center);
+    SCIPfreeMemory(scip, stabilization);
+}
+
+/** Forgets the center, e.g. at a new node of the branching tree */
+extern
+void dualStabilizationReset(
+    dual_stabilization* stabilization
+    )
+{
+    assert(stabilization != NULL);
+
+    stabilization->hasCenter = FALSE;
+    stabilization->isSmoothed = FALSE;
+    stabilization->centerBound = -SCIP_DEFAULT_INFINITY;
+}
+
+/** Starts a round of exact pricing, the dual values of the round are the dual values of the LP smoothed with the center */
+extern
+void dualStabilizationStartRound(
+    dual_stabilization* stabilization,
+    double*         duals
+    )
+{
+    double alpha;
+    int i;
+
+    assert(stabilization != NULL);
+    assert(duals != NULL);
+
+    alpha = stabilization->alpha;
+    stabilization->nrounds++;
+    stabilization->isSmoothed = stabilization->hasCenter && alpha > 0.0;
+    if (stabilization->isSmoothed)
+    {
+        stabilization->nsmoothed++;
+        for (i = 0; i < stabilization->nconss; i++)
+        {
+            stabilization->duals[i] = alpha * stabilization->center[i] + (1.0 - alpha) * duals[i];
+        }
+    }
+    else
+    {
+        memcpy(stabilization->duals, duals, stabilization->nconss * sizeof(double));
+    }
+    /* the true dual values of the first round at a node are the center until a misprice has a known bound */
+    if (!stabilization->hasCenter)
+    {
+        memcpy(stabilization->center, duals, stabilization->nconss * sizeof(double));
+        stabilization->centerBound = -SCIP_DEFAULT_INFINITY;
+        stabilization->hasCenter = TRUE;
+    }
+}
+
+/**
+ * Finishes a round, its dual values become the center if their Lagrangian bound is proven and better. If no new column
+ * was found with smoothed dual values, they are replaced by the true ones. */
+extern
+SCIP_Bool dualStabilizationEndRound(
+    dual_stabilization* stabilization,
+    SCIP_Bool       foundColumns,
+    double*         minRedCosts,
+    SCIP_Bool*      isProven,
+    int             nDays,
+    double*         duals
+    )
+{
+    double bound;
+    SCIP_Bool isMisprice = TRUE;
+    int i;
+
+    assert(stabilization != NULL);
+    assert(minRedCosts != NULL);
+    assert(isProven != NULL);
+    assert(duals != NULL);
+
+    bound = getLagrangianBound(stabilization, minRedCosts, isProven, nDays);
+    if (bound > stabilization->centerBound)
+    {
+        memcpy(stabilization->center, stabilization->duals, stabilization->nconss * sizeof(double));
+        stabilization->centerBound = bound;
+        stabilization->ncenterUpdates++;
+    }
+    if (!stabilization->isSmoothed)
+    {
+        return FALSE;
+    }
+    stabilization->isSmoothed = FALSE;
+    if (foundColumns)
+    {
+        stabilization->nsmoothedSuccess++;
+        return FALSE;
+    }
+    /* tours with negative reduced costs that are already contained in the master problem are no misprice */
+    for (i = 0; i < nDays; i++)
+    {
+        if (minRedCosts[i] < 0.0)
+        {
+            isMisprice = FALSE;
+        }
+    }
+    if (isMisprice)
+    {
+        stabilization->nmisprices++;
+    }
+    /* the round is repeated with the true dual values */
+    memcpy(stabilization->duals, duals, stabilization->nconss * sizeof(double));
+
+    return TRUE;
+}
+
+/** Prints the number of rounds, misprices and updates of the center */
+extern
+void dualStabilizationPrintStatistics(
+    SCIP*           scip,
+    dual_stabilization* stabilization
+    )
+{
+    assert(stabilization != NULL);
+
+    SCIPinfoMessage(scip, NULL, "dual stabilization (alpha %.2f): %lld exact pricing rounds, %lld with smoothed dual "
+                    "values, %lld of them found columns, %lld misprices, %lld of them updated the center\n",
+                    stabilization->alpha, stabilization->nrounds, stabilization->nsmoothed,
+                    stabilization->nsmoothedSuccess, stabilization->nmisprices, stabilization->ncenterUpdates);
+}
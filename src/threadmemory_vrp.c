@@ -0,0 +1,269 @@
+/**@file   threadmemory_vrp.c
+ * @brief  thread-local memory pools for the labels and the scratch memory of the labeling algorithm
+ * @author Lukas Schürmann, University Bonn
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "scip/scip.h"
+#include "threadmemory_vrp.h"
+
+/** header in front of every block, its size keeps the blocks aligned */
+typedef struct _thread_memory_header
+{
+    size_t              size;               /**< usable size of the block */
+    int                 sizeclass;          /**< size class of the block, -1 if it was taken from the system directly */
+    int                 padding;
+} thread_memory_header;
+
+/** returns the header of a block */
+#define blockHeader(block)          ( (thread_memory_header*) ((char*) (block) - sizeof(thread_memory_header)) )
+
+/** pool of the calling thread, NULL before its first allocation */
+static _Thread_local thread_memory* localMemory = NULL;
+
+/** pools of all threads */
+static thread_memory* allMemories = NULL;
+static pthread_mutex_t allMemoriesMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Local functions
+ */
+
+/** returns the pool of the calling thread, it is created on first use */
+static
+SCIP_RETCODE getLocalMemory(
+    thread_memory**     memory
+    )
+{
+    if (localMemory == NULL)
+    {
+        localMemory = calloc(1, sizeof(thread_memory));
+        if (localMemory == NULL)
+        {
+            SCIPerrorMessage("could not allocate the memory pool of a labeling thread\n");
+            return SCIP_NOMEMORY;
+        }
+        pthread_mutex_lock(&allMemoriesMutex);
+        localMemory->next = allMemories;
+        allMemories = localMemory;
+        pthread_mutex_unlock(&allMemoriesMutex);
+    }
+    *memory = localMemory;
+
+    return SCIP_OKAY;
+}
+
+/** returns the smallest size class that can hold size bytes, THREAD_MEMORY_NCLASSES if there is none */
+static
+int getSizeClass(
+    size_t              size
+    )
+{
+    size_t classsize = THREAD_MEMORY_MINSIZE;
+    int sizeclass = 0;
+
+    while (classsize < size && sizeclass < THREAD_MEMORY_NCLASSES)
+    {
+        classsize <<= 1;
+        sizeclass++;
+    }
+    return sizeclass;
+}
+
+/**
+ * Interface functions
+ */
+
+/** Allocates a block from the pool of the calling thread */
+extern
+SCIP_RETCODE threadMemoryAlloc(
+    void**              ptr,
+    size_t              size
+    )
+{
+    thread_memory* memory;
+    thread_memory_header* header;
+    int sizeclass;
+
+    assert(ptr != NULL);
+
+    SCIP_CALL( getLocalMemory(&memory) );
+    sizeclass = getSizeClass(size);
+
+    if (sizeclass < THREAD_MEMORY_NCLASSES && memory->freelists[sizeclass] != NULL)
+    {
+        /* the first bytes of a freed block point to the next one of its class */
+        void* block = memory->freelists[sizeclass];
+        memory->freelists[sizeclass] = *(void**) block;
+        header = blockHeader(block);
+        memory->nbytesCached -= (long long) header->size;
+        memory->nreused++;
+    }
+    else
+    {
+        size_t blocksize = (sizeclass < THREAD_MEMORY_NCLASSES ? (size_t) THREAD_MEMORY_MINSIZE << sizeclass
+                                                               : MAX(size, 1));
+        header = malloc(sizeof(thread_memory_header) + blocksize);
+        if (header == NULL)
+        {
+            SCIPerrorMessage("could not allocate %zu bytes in the memory pool of a labeling thread\n", size);
+            return SCIP_NOMEMORY;
+        }
+        header->size = blocksize;
+        header->sizeclass = (sizeclass < THREAD_MEMORY_NCLASSES ? sizeclass : -1);
+        if (sizeclass < THREAD_MEMORY_NCLASSES)
+        {
+            memory->nbytesSystem += (long long) blocksize;
+        }
+    }
+
+    memory->nallocs++;
+    memory->nbytesInUse += (long long) header->size;
+    memory->nbytesPeak = MAX(memory->nbytesPeak, memory->nbytesInUse);
+    *ptr = (char*) header + sizeof(thread_memory_header);
+
+    return SCIP_OKAY;
+}
+
+/** Allocates a block from the pool of the calling thread and sets it to zero */
+extern
+SCIP_RETCODE threadMemoryAllocClear(
+    void**              ptr,
+    size_t              size
+    )
+{
+    SCIP_CALL( threadMemoryAlloc(ptr, size) );
+    memset(*ptr, 0, size);
+
+    return SCIP_OKAY;
+}
+
+/** Changes the size of a block, the content is kept, a NULL block is allocated */
+extern
+SCIP_RETCODE threadMemoryRealloc(
+    void**              ptr,
+    size_t              size
+    )
+{
+    void* block;
+    size_t oldsize;
+
+    assert(ptr != NULL);
+
+    if (*ptr == NULL)
+    {
+        return threadMemoryAlloc(ptr, size);
+    }
+
+    /* the block is large enough already */
+    oldsize = blockHeader(*ptr)->size;
+    if (size <= oldsize)
+    {
+        return SCIP_OKAY;
+    }
+
+    SCIP_CALL( threadMemoryAlloc(&block, size) );
+    memcpy(block, *ptr, oldsize);
+    threadMemoryFree(ptr);
+    *ptr = block;
+
+    return SCIP_OKAY;
+}
+
+/** Gives a block back to the pool of the calling thread and sets the pointer to NULL */
+extern
+void threadMemoryFree(
+    void**              ptr
+    )
+{
+    thread_memory* memory;
+    thread_memory_header* header;
+
+    assert(ptr != NULL);
+
+    if (*ptr == NULL)
+    {
+        return;
+    }
+    /* a thread can only free a block, if it allocated one before or the pool can be created */
+    if (getLocalMemory(&memory) != SCIP_OKAY)
+    {
+        free(blockHeader(*ptr));
+        *ptr = NULL;
+        return;
+    }
+
+    header = blockHeader(*ptr);
+    memory->nfrees++;
+    memory->nbytesInUse -= (long long) header->size;
+    if (header->sizeclass < 0)
+    {
+        free(header);
+    }
+    else if (memory->nbytesCached + (long long) header->size > THREAD_MEMORY_MAXCACHED)
+    {
+        /* the free lists of this thread are full */
+        free(header);
+        memory->nreleased++;
+    }
+    else
+    {
+        *(void**) *ptr = memory->freelists[header->sizeclass];
+        memory->freelists[header->sizeclass] = *ptr;
+        memory->nbytesCached += (long long) header->size;
+    }
+    *ptr = NULL;
+}
+
+/** Prints the statistics of the pools of all threads */
+extern
+void threadMemoryPrintStatistics(
+    SCIP*               scip
+    )
+{
+    thread_memory* memory;
+    int i = 0;
+
+    pthread_mutex_lock(&allMemoriesMutex);
+    for (memory = allMemories; memory != NULL; memory = memory->next)
+    {
+        SCIPinfoMessage(scip, NULL, "labeling memory of thread %d: %lld allocations (%lld reused), %lld frees "
+                        "(%lld released), %lld bytes in use, %lld bytes peak, %lld bytes taken from the system, "
+                        "%lld bytes cached\n", i++, memory->nallocs, memory->nreused, memory->nfrees,
+                        memory->nreleased, memory->nbytesInUse, memory->nbytesPeak, memory->nbytesSystem,
+                        memory->nbytesCached);
+    }
+    pthread_mutex_unlock(&allMemoriesMutex);
+}
+
+/** Frees the pools of all threads */
+extern
+void threadMemoryFreeAll(
+    void
+    )
+{
+    pthread_mutex_lock(&allMemoriesMutex);
+    while (allMemories != NULL)
+    {
+        thread_memory* memory = allMemories;
+        int k;
+
+        for (k = 0; k < THREAD_MEMORY_NCLASSES; k++)
+        {
+            while (memory->freelists[k] != NULL)
+            {
+                void* block = memory->freelists[k];
+                memory->freelists[k] = *(void**) block;
+                free(blockHeader(block));
+            }
+        }
+        allMemories = memory->next;
+        free(memory);
+    }
+    localMemory = NULL;
+    pthread_mutex_unlock(&allMemoriesMutex);
+}
@@ -0,0 +1,238 @@
+/**@file   threadpool_vrp.c
+ * @brief  long-lived pool of threads that run the tasks of the labeling algorithm
+ * @author Lukas Schürmann, University Bonn
+ */
+
+#include <assert.h>
+#include <unistd.h>
+
+#include "scip/scip.h"
+#include "threadpool_vrp.h"
+#include "threadmemory_vrp.h"
+
+/**
+ * Local functions
+ */
+
+/** removes the first task from the queue, the mutex must be locked */
+static
+thread_task* popTask(
+    thread_pool*        pool
+    )
+{
+    thread_task* task = pool->first;
+
+    if (task != NULL)
+    {
+        pool->first = task->next;
+        if (pool->first == NULL)
+        {
+            pool->last = NULL;
+        }
+    }
+    return task;
+}
+
+/** runs a task that was taken from the queue, the mutex must be locked and is locked again on return */
+static
+void runTask(
+    thread_pool*        pool,
+    thread_task*        task
+    )
+{
+    thread_group* group = task->group;
+    SCIP_RETCODE retcode;
+
+    pthread_mutex_unlock(&pool->mutex);
+    retcode = task->func(task->arg);
+    threadFreeMemory(&task);
+    pthread_mutex_lock(&pool->mutex);
+
+    if (retcode != SCIP_OKAY && group->retcode == SCIP_OKAY)
+    {
+        group->retcode = retcode;
+    }
+    group->npending--;
+    pthread_cond_broadcast(&pool->taskFinished);
+}
+
+/** main loop of a thread of the pool */
+static
+void* poolThread(
+    void*               arguments
+    )
+{
+    thread_pool* pool = arguments;
+
+    pthread_mutex_lock(&pool->mutex);
+    while (!pool->isShutdown)
+    {
+        thread_task* task = popTask(pool);
+        if (task == NULL)
+        {
+            pthread_cond_wait(&pool->taskAvailable, &pool->mutex);
+            continue;
+        }
+        runTask(pool, task);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+}
+
+/**
+ * Interface functions
+ */
+
+/** Creates a pool and starts its threads */
+extern
+SCIP_RETCODE threadPoolCreate(
+    SCIP*               scip,
+    thread_pool**       pool,
+    int                 nthreads
+    )
+{
+    int i;
+
+    assert(scip != NULL);
+    assert(pool != NULL);
+
+    if (nthreads <= 0)
+    {
+        nthreads = MAX(1, (int) sysconf(_SC_NPROCESSORS_ONLN) - 1);
+    }
+
+    SCIP_CALL( SCIPallocMemory(scip, pool) );
+    (*pool)->nthreads = nthreads;
+    (*pool)->first = NULL;
+    (*pool)->last = NULL;
+    (*pool)->isShutdown = FALSE;
+    pthread_mutex_init(&(*pool)->mutex, NULL);
+    pthread_cond_init(&(*pool)->taskAvailable, NULL);
+    pthread_cond_init(&(*pool)->taskFinished, NULL);
+
+    SCIP_CALL( SCIPallocMemoryArray(scip, &(*pool)->threads, nthreads) );
+    for (i = 0; i < nthreads; i++)
+    {
+        if (pthread_create(&(*pool)->threads[i], NULL, poolThread, *pool) != 0)
+        {
+            SCIPerrorMessage("could not start thread %d of the labeling thread pool\n", i);
+            /* stop and join the threads that were already started */
+            (*pool)->nthreads = i;
+            SCIP_CALL( threadPoolFree(scip, pool) );
+            return SCIP_ERROR;
+        }
+    }
+
+    return SCIP_OKAY;
+}
+
+/** Stops the threads of the pool and frees it */
+extern
+SCIP_RETCODE threadPoolFree(
+    SCIP*               scip,
+    thread_pool**       pool
+    )
+{
+    int i;
+
+    assert(pool != NULL);
+    assert(*pool != NULL);
+    assert((*pool)->first == NULL);
+
+    pthread_mutex_lock(&(*pool)->mutex);
+    (*pool)->isShutdown = TRUE;
+    pthread_cond_broadcast(&(*pool)->taskAvailable);
+    pthread_mutex_unlock(&(*pool)->mutex);
+
+    for (i = 0; i < (*pool)->nthreads; i++)
+    {
+        pthread_join((*pool)->threads[i], NULL);
+    }
+    pthread_cond_destroy(&(*pool)->taskFinished);
+    pthread_cond_destroy(&(*pool)->taskAvailable);
+    pthread_mutex_destroy(&(*pool)->mutex);
+    SCIPfreeMemoryArray(scip, &(*pool)->threads);
+    SCIPfreeMemory(scip, pool);
+
+    return SCIP_OKAY;
+}
+
+/** Initializes an empty group of tasks */
+extern
+void threadGroupInit(
+    thread_group*       group
+    )
+{
+    assert(group != NULL);
+
+    group->npending = 0;
+    group->retcode = SCIP_OKAY;
+}
+
+/** Queues a task of the group */
+extern
+SCIP_RETCODE threadPoolSubmit(
+    thread_pool*        pool,
+    thread_group*       group,
+    thread_task_func    func,
+    void*               arg
+    )
+{
+    thread_task* task;
+
+    assert(pool != NULL);
+    assert(group != NULL);
+    assert(func != NULL);
+
+    SCIP_CALL( threadAllocMemory(&task) );
+    task->func = func;
+    task->arg = arg;
+    task->group = group;
+    task->next = NULL;
+
+    pthread_mutex_lock(&pool->mutex);
+    if (pool->last == NULL)
+    {
+        pool->first = task;
+    }
+    else
+    {
+        pool->last->next = task;
+    }
+    pool->last = task;
+    group->npending++;
+    pthread_cond_signal(&pool->taskAvailable);
+    pthread_mutex_unlock(&pool->mutex);
+
+    return SCIP_OKAY;
+}
+
+/** Waits until all tasks of the group are finished and runs queued tasks in the meantime */
+extern
+SCIP_RETCODE threadPoolWait(
+    thread_pool*        pool,
+    thread_group*       group
+    )
+{
+    SCIP_RETCODE retcode;
+
+    assert(pool != NULL);
+    assert(group != NULL);
+
+    pthread_mutex_lock(&pool->mutex);
+    while (group->npending > 0)
+    {
+        thread_task* task = popTask(pool);
+        if (task == NULL)
+        {
+            pthread_cond_wait(&pool->taskFinished, &pool->mutex);
+            continue;
+        }
+        runTask(pool, task);
+    }
+    retcode = group->retcode;
+    pthread_mutex_unlock(&pool->mutex);
+
+    return retcode;
+}
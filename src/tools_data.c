@@ -1777,15 +1777,15 @@ SCIP_RETCODE createModelData(
    assert( modelData->t_service != NULL );
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(modelData->t_service_maxDev), modelData->nC) );
    assert( modelData->t_service_maxDev != NULL );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(modelData->t_travelAM), modelData->nC) );
+   SCIP_CALL( allocTravelMatrix(scip, &(modelData->t_travelAM), modelData->nC) );
    assert( modelData->t_travelAM != NULL );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(modelData->t_travelNoon), modelData->nC) );
+   SCIP_CALL( allocTravelMatrix(scip, &(modelData->t_travelNoon), modelData->nC) );
    assert( modelData->t_travelNoon != NULL );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(modelData->t_travelPM), modelData->nC) );
+   SCIP_CALL( allocTravelMatrix(scip, &(modelData->t_travelPM), modelData->nC) );
    assert( modelData->t_travelPM != NULL );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(modelData->t_travel), modelData->nC) );
+   SCIP_CALL( allocTravelMatrix(scip, &(modelData->t_travel), modelData->nC) );
    assert( modelData->t_travel != NULL );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(modelData->t_travel_maxDev), modelData->nC) );
+   SCIP_CALL( allocTravelMatrix(scip, &(modelData->t_travel_maxDev), modelData->nC) );
    assert( modelData->t_travel_maxDev != NULL );
    SCIP_CALL( SCIPallocBlockMemory(scip, &(modelData->startDate)) );
    assert( modelData->startDate != NULL );
@@ -1798,16 +1798,6 @@ SCIP_RETCODE createModelData(
    for (k = 0; k < (modelData->nC); k++)
    {
       modelData->timeWindows[k] = NULL; /* list elements will be allocated on an as-needed basis */
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(modelData->t_travelAM[k]), modelData->nC) );
-      assert( modelData->t_travelAM[k] != NULL );
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(modelData->t_travelNoon[k]), modelData->nC) );
-      assert( modelData->t_travelNoon[k] != NULL );
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(modelData->t_travelPM[k]), modelData->nC) );
-      assert( modelData->t_travelPM[k] != NULL );
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(modelData->t_travel[k]), modelData->nC) );
-      assert( modelData->t_travel[k] != NULL );
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(modelData->t_travel_maxDev[k]), modelData->nC) );
-      assert( modelData->t_travel_maxDev[k] != NULL );
    }
 
    /* derive and/or copy data parameters from instance data */
@@ -1907,11 +1897,14 @@ SCIP_RETCODE createModelData(
        }
    }
    modelData->neighbors = NULL; /* when being created, neighbor information is not yet present (corresp. to full digraph for every day); will be filled in preprocessing eventually */
+   modelData->neighborGraph = NULL;
+   modelData->travelSlices = NULL;
    /* default day sizes */
    for(i = 0; i < modelData->nDays; i++)
    {
        modelData->day_sizes[i] = modelData->nC - 1;
    }
+   SCIP_CALL( createWindowTable(scip, modelData) );
 
    return SCIP_OKAY;
 }
@@ -1928,6 +1921,12 @@ SCIP_RETCODE deinitModelData(
    modelWindow* tmp_tw = NULL;
    neighbor* tmp_nb    = NULL;
 
+   freeWindowTable(scip, modelData);
+   freeTravelSlices(scip, modelData);
+   if( modelData->neighborGraph != NULL )
+   {
+      freeNeighborGraph(scip, &(modelData->neighborGraph));
+   }
    for (k = (modelData->nC)-1; k >= 0; k--)
    {
       if( modelData->neighbors != NULL )
@@ -1948,11 +1947,6 @@ SCIP_RETCODE deinitModelData(
               }
           }
       }
-      SCIPfreeBlockMemoryArray(scip, &(modelData->t_travel_maxDev[k]), modelData->nC);
-      SCIPfreeBlockMemoryArray(scip, &(modelData->t_travel[k]), modelData->nC);
-      SCIPfreeBlockMemoryArray(scip, &(modelData->t_travelPM[k]), modelData->nC);
-      SCIPfreeBlockMemoryArray(scip, &(modelData->t_travelNoon[k]), modelData->nC);
-      SCIPfreeBlockMemoryArray(scip, &(modelData->t_travelAM[k]), modelData->nC);
       while( modelData->timeWindows[k] != NULL )
       {
          tmp_tw = modelData->timeWindows[k];
@@ -1975,11 +1969,11 @@ SCIP_RETCODE deinitModelData(
    SCIPfreeBlockMemoryArray(scip, &(modelData->days), modelData->nDays);
    SCIPfreeBlockMemoryArray(scip, &(modelData->t_service_maxDev), modelData->nC);
    SCIPfreeBlockMemoryArray(scip, &(modelData->t_service), modelData->nC);
-   SCIPfreeBlockMemoryArray(scip, &(modelData->t_travel_maxDev), modelData->nC);
-   SCIPfreeBlockMemoryArray(scip, &(modelData->t_travel), modelData->nC);
-   SCIPfreeBlockMemoryArray(scip, &(modelData->t_travelPM), modelData->nC);
-   SCIPfreeBlockMemoryArray(scip, &(modelData->t_travelNoon), modelData->nC);
-   SCIPfreeBlockMemoryArray(scip, &(modelData->t_travelAM), modelData->nC);
+   freeTravelMatrix(scip, &(modelData->t_travel_maxDev), modelData->nC);
+   freeTravelMatrix(scip, &(modelData->t_travel), modelData->nC);
+   freeTravelMatrix(scip, &(modelData->t_travelPM), modelData->nC);
+   freeTravelMatrix(scip, &(modelData->t_travelNoon), modelData->nC);
+   freeTravelMatrix(scip, &(modelData->t_travelAM), modelData->nC);
    SCIPfreeBlockMemoryArray(scip, &(modelData->timeWindows), modelData->nC);
    SCIPfreeBlockMemoryArray(scip, &(modelData->obj), modelData->nC);
    SCIPfreeBlockMemoryArray(scip, &(modelData->customerIDs), modelData->nC);
@@ -1990,6 +1984,386 @@ SCIP_RETCODE deinitModelData(
 
 
 
+/** build the window table of the model data from its time window lists */
+SCIP_RETCODE createWindowTable(
+   SCIP* scip,                            /**< SCIP pointer */
+   model_data* modelData                  /**< model data with complete time window lists */
+   )
+{
+   window_table* table;
+   modelWindow* tw;
+   int* pos;
+   int i,k;
+
+   assert( modelData != NULL );
+   assert( modelData->timeWindows != NULL );
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, &table) );
+   table->nDays = modelData->nDays;
+   table->nwindows = 0;
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &(table->first), modelData->nC * modelData->nDays + 1) );
+
+   /* count the windows of each customer and day */
+   for( i = 0; i < modelData->nC; i++ )
+   {
+      for( tw = modelData->timeWindows[i]; tw != NULL; tw = tw->next )
+      {
+         assert( 0 <= tw->day && tw->day < modelData->nDays );
+         table->first[i * modelData->nDays + tw->day + 1]++;
+         table->nwindows++;
+      }
+   }
+   for( k = 0; k < modelData->nC * modelData->nDays; k++ )
+   {
+      table->first[k + 1] += table->first[k];
+   }
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(table->start_t), MAX(1, table->nwindows)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(table->end_t), MAX(1, table->nwindows)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(table->windows), MAX(1, table->nwindows)) );
+
+   /* insert the windows of each customer and day sorted by start time, windows with equal start keep their order */
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &pos, modelData->nC * modelData->nDays) );
+   for( k = 0; k < modelData->nC * modelData->nDays; k++ )
+   {
+      pos[k] = table->first[k];
+   }
+   for( i = 0; i < modelData->nC; i++ )
+   {
+      for( tw = modelData->timeWindows[i]; tw != NULL; tw = tw->next )
+      {
+         int begin = table->first[i * modelData->nDays + tw->day];
+         int j = pos[i * modelData->nDays + tw->day]++;
+
+         while( j > begin && table->start_t[j - 1] > tw->start_t )
+         {
+            table->start_t[j] = table->start_t[j - 1];
+            table->end_t[j] = table->end_t[j - 1];
+            table->windows[j] = table->windows[j - 1];
+            j--;
+         }
+         table->start_t[j] = tw->start_t;
+         table->end_t[j] = tw->end_t;
+         table->windows[j] = tw;
+      }
+   }
+   SCIPfreeBlockMemoryArray(scip, &pos, modelData->nC * modelData->nDays);
+
+   modelData->windowTable = table;
+
+   return SCIP_OKAY;
+}
+
+
+
+/** free the window table of the model data */
+void freeWindowTable(
+   SCIP* scip,                            /**< SCIP pointer */
+   model_data* modelData                  /**< model data */
+   )
+{
+   window_table* table = modelData->windowTable;
+
+   if( table == NULL )
+   {
+      return;
+   }
+   SCIPfreeBlockMemoryArray(scip, &(table->windows), MAX(1, table->nwindows));
+   SCIPfreeBlockMemoryArray(scip, &(table->end_t), MAX(1, table->nwindows));
+   SCIPfreeBlockMemoryArray(scip, &(table->start_t), MAX(1, table->nwindows));
+   SCIPfreeBlockMemoryArray(scip, &(table->first), modelData->nC * table->nDays + 1);
+   SCIPfreeBlockMemory(scip, &table);
+   modelData->windowTable = NULL;
+}
+
+
+
+/** allocate a (nC x nC) travel time matrix, the rows are parts of one contiguous block and start at 64 byte boundaries */
+SCIP_RETCODE allocTravelMatrix(
+   SCIP* scip,                            /**< SCIP pointer */
+   int*** matrix,                         /**< pointer to the row pointers of the matrix */
+   int nC                                 /**< number of customers + 1 */
+   )
+{
+   int* block;
+   int* base;
+   int i;
+
+   assert( matrix != NULL );
+   assert( nC > 0 );
+
+   /* the last row pointer keeps the block as it was allocated to free it again */
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, matrix, nC + 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &block, travelMatrixBlockSize(nC)) );
+   base = (int*) (((size_t) block + TRAVEL_MATRIX_ALIGNMENT - 1) & ~((size_t) TRAVEL_MATRIX_ALIGNMENT - 1));
+   for( i = 0; i < nC; i++ )
+   {
+      (*matrix)[i] = &base[i * travelMatrixRowSize(nC)];
+   }
+   (*matrix)[nC] = block;
+
+   return SCIP_OKAY;
+}
+
+
+
+/** free a travel time matrix that was allocated by allocTravelMatrix */
+void freeTravelMatrix(
+   SCIP* scip,                            /**< SCIP pointer */
+   int*** matrix,                         /**< pointer to the row pointers of the matrix */
+   int nC                                 /**< number of customers + 1 */
+   )
+{
+   assert( matrix != NULL );
+   assert( *matrix != NULL );
+
+   SCIPfreeBlockMemoryArray(scip, &((*matrix)[nC]), travelMatrixBlockSize(nC));
+   SCIPfreeBlockMemoryArray(scip, matrix, nC + 1);
+}
+
+
+
+/** build the travel times of the periods of a day for time dependent travel times from the AM, noon, PM and average matrices
+ *
+ *  The travel time of an arc is constant within a period and changes linearly within a transition that is centered at
+ *  the end of the period. The transitions are at least as long as the largest decrease of a travel time between two
+ *  periods, so no travel time decreases faster than the time passes and a later departure never arrives earlier.
+ */
+SCIP_RETCODE createTravelSlices(
+   SCIP* scip,                            /**< SCIP pointer */
+   model_data* modelData,                 /**< model data with complete travel time matrices */
+   const int* periodEnds,                 /**< (TRAVEL_SLICES - 1)-array with the increasing end times of the first periods */
+   int minTransition                      /**< minimal length of the transitions (in seconds) */
+   )
+{
+   int** matrices[TRAVEL_SLICES];
+   int maxTransition;
+   int transition;
+   int i,j,k;
+
+   assert( modelData != NULL );
+   assert( periodEnds != NULL );
+   assert( modelData->travelSlices == NULL );
+
+   matrices[0] = modelData->t_travelAM;
+   matrices[1] = modelData->t_travelNoon;
+   matrices[2] = modelData->t_travelPM;
+   matrices[3] = modelData->t_travel;
+
+   /* the transitions must not overlap */
+   maxTransition = 2 * periodEnds[0];
+   for( k = 0; k < TRAVEL_SLICES - 2; k++ )
+   {
+      assert( periodEnds[k] < periodEnds[k + 1] );
+      maxTransition = MIN(maxTransition, periodEnds[k + 1] - periodEnds[k]);
+   }
+
+   transition = minTransition;
+   for( i = 0; i < modelData->nC; i++ )
+   {
+      for( j = 0; j < modelData->nC; j++ )
+      {
+         for( k = 0; k < TRAVEL_SLICES; k++ )
+         {
+            if( matrices[k][i][j] < 0 || matrices[k][i][j] > TRAVEL_SLICE_MAXTIME )
+            {
+               return SCIP_OKAY;
+            }
+            if( k > 0 )
+            {
+               transition = MAX(transition, matrices[k - 1][i][j] - matrices[k][i][j]);
+            }
+         }
+      }
+   }
+   if( transition > maxTransition )
+   {
+      SCIPwarningMessage(scip, "travel times drop by up to %d seconds between two periods, later departures may arrive earlier\n", transition);
+      transition = maxTransition;
+   }
+   transition = MAX(1, transition);
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(modelData->travelSlices), modelData->nC * modelData->nC) );
+   for( i = 0; i < modelData->nC; i++ )
+   {
+      for( j = 0; j < modelData->nC; j++ )
+      {
+         for( k = 0; k < TRAVEL_SLICES; k++ )
+         {
+            modelData->travelSlices[i * modelData->nC + j].travel[k] = (unsigned short) matrices[k][i][j];
+         }
+      }
+   }
+   modelData->travelTransition = transition;
+   modelData->travelSegmentStart[0] = 0;
+   for( k = 0; k < TRAVEL_SLICES - 1; k++ )
+   {
+      modelData->travelSegmentStart[2 * k + 1] = periodEnds[k] - transition / 2;
+      modelData->travelSegmentStart[2 * k + 2] = periodEnds[k] - transition / 2 + transition;
+   }
+
+   return SCIP_OKAY;
+}
+
+
+
+/** free the travel times of the periods of a day */
+void freeTravelSlices(
+   SCIP* scip,                            /**< SCIP pointer */
+   model_data* modelData                  /**< model data */
+   )
+{
+   if( modelData->travelSlices == NULL )
+   {
+      return;
+   }
+   SCIPfreeBlockMemoryArray(scip, &(modelData->travelSlices), modelData->nC * modelData->nC);
+}
+
+
+
+/** create an empty neighbor graph with room for maxarcs arcs */
+SCIP_RETCODE createNeighborGraph(
+   SCIP* scip,                            /**< SCIP pointer */
+   neighbor_graph** graph,                /**< pointer to the graph */
+   int nC,                                /**< number of customers + 1 */
+   int nDays,                             /**< number of days */
+   int maxarcs                            /**< maximal number of arcs */
+   )
+{
+   assert( graph != NULL );
+   assert( nC > 0 && nDays > 0 );
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, graph) );
+   (*graph)->nC = nC;
+   (*graph)->nDays = nDays;
+   (*graph)->maxarcs = MAX(1, maxarcs);
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &((*graph)->first), nC * nDays + 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &((*graph)->heads), (*graph)->maxarcs) );
+   clearNeighborGraph(*graph);
+   finishNeighborGraph(*graph);
+
+   return SCIP_OKAY;
+}
+
+
+
+/** free a neighbor graph */
+void freeNeighborGraph(
+   SCIP* scip,                            /**< SCIP pointer */
+   neighbor_graph** graph                 /**< pointer to the graph */
+   )
+{
+   assert( graph != NULL );
+   assert( *graph != NULL );
+
+   SCIPfreeBlockMemoryArray(scip, &((*graph)->heads), (*graph)->maxarcs);
+   SCIPfreeBlockMemoryArray(scip, &((*graph)->first), (*graph)->nC * (*graph)->nDays + 1);
+   SCIPfreeBlockMemory(scip, graph);
+}
+
+
+
+/** remove all arcs of a neighbor graph to build it again */
+void clearNeighborGraph(
+   neighbor_graph* graph                  /**< neighbor graph */
+   )
+{
+   assert( graph != NULL );
+
+   graph->narcs = 0;
+   graph->nstarted = 0;
+}
+
+
+
+/** append an arc to a neighbor graph that is built, the arcs have to be appended in increasing order of node and day */
+void addNeighborGraphArc(
+   neighbor_graph* graph,                 /**< neighbor graph */
+   int node,                              /**< tail of the arc */
+   int day,                               /**< day of the arc */
+   int head                               /**< head of the arc */
+   )
+{
+   int k = node * graph->nDays + day;
+
+   assert( 0 <= node && node < graph->nC );
+   assert( 0 <= head && head < graph->nC );
+   assert( 0 <= day && day < graph->nDays );
+   assert( graph->nstarted <= k + 1 );
+   assert( graph->narcs < graph->maxarcs );
+
+   while( graph->nstarted <= k )
+   {
+      graph->first[graph->nstarted++] = graph->narcs;
+   }
+   graph->heads[graph->narcs++] = head;
+}
+
+
+
+/** finish building a neighbor graph, all customers and days without appended arcs get no neighbors */
+void finishNeighborGraph(
+   neighbor_graph* graph                  /**< neighbor graph */
+   )
+{
+   assert( graph != NULL );
+
+   while( graph->nstarted <= graph->nC * graph->nDays )
+   {
+      graph->first[graph->nstarted++] = graph->narcs;
+   }
+}
+
+
+
+/** build the neighbor graph of the model data from its neighbor lists */
+SCIP_RETCODE createModelNeighborGraph(
+   SCIP* scip,                            /**< SCIP pointer */
+   model_data* modelData                  /**< model data with complete neighbor lists */
+   )
+{
+   neighbor_graph* graph;
+   neighbor* nb;
+   int narcs = 0;
+   int i,j;
+
+   assert( modelData != NULL );
+
+   modelData->neighborGraph = NULL;
+   if( modelData->neighbors == NULL )
+   {
+      return SCIP_OKAY;
+   }
+   for( i = 0; i < modelData->nC; i++ )
+   {
+      for( j = 0; j < modelData->nDays; j++ )
+      {
+         for( nb = modelData->neighbors[i][j]; nb != NULL; nb = nb->next )
+         {
+            narcs++;
+         }
+      }
+   }
+   SCIP_CALL( createNeighborGraph(scip, &graph, modelData->nC, modelData->nDays, narcs) );
+   clearNeighborGraph(graph);
+   for( i = 0; i < modelData->nC; i++ )
+   {
+      for( j = 0; j < modelData->nDays; j++ )
+      {
+         for( nb = modelData->neighbors[i][j]; nb != NULL; nb = nb->next )
+         {
+            addNeighborGraphArc(graph, i, j, nb->id);
+         }
+      }
+   }
+   finishNeighborGraph(graph);
+   modelData->neighborGraph = graph;
+
+   return SCIP_OKAY;
+}
+
+
+
 /** derive and set model service times and assoc. max. deviations from instance data */
 SCIP_RETCODE setModelServiceTimes(
    int* t_service,                        /**< pointer to where model service time is to be stored */
@@ -2951,12 +3325,10 @@ SCIP_RETCODE readModelData(
    /* morning travel time matrix */
    (void)! fgets(strbuffer, MAXSTRLEN, inFILE); /* commentary line -> field int** t_travelAM */
    assert( ! strncmp(strbuffer,"# morning/AM travel time",24) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip,&(modelData->t_travelAM),modelData->nC) );
+   SCIP_CALL( allocTravelMatrix(scip,&(modelData->t_travelAM),modelData->nC) );
    assert( modelData->t_travelAM != NULL );
    for( i = 0; i < modelData->nC; i++ ) /* from... */
    {
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip,&(modelData->t_travelAM[i]),modelData->nC) );
-      assert( modelData->t_travelAM[i] != NULL );
       (void)! fgets(strbuffer, MAXSTRLEN, inFILE);
       k = 0;
       j = 0;
@@ -2977,12 +3349,10 @@ SCIP_RETCODE readModelData(
    /* noon travel time matrix */
    (void)! fgets(strbuffer, MAXSTRLEN, inFILE); /* commentary line -> field int** t_travelNoon */
    assert( ! strncmp(strbuffer,"# noon travel time",18) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip,&(modelData->t_travelNoon),modelData->nC) );
+   SCIP_CALL( allocTravelMatrix(scip,&(modelData->t_travelNoon),modelData->nC) );
    assert( modelData->t_travelNoon != NULL );
    for( i = 0; i < modelData->nC; i++ ) /* from... */
    {
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip,&(modelData->t_travelNoon[i]),modelData->nC) );
-      assert( modelData->t_travelNoon[i] != NULL );
       (void)! fgets(strbuffer, MAXSTRLEN, inFILE);
       k = 0;
       j = 0;
@@ -3003,12 +3373,10 @@ SCIP_RETCODE readModelData(
    /* afternoon travel time matrix */
    (void)! fgets(strbuffer, MAXSTRLEN, inFILE); /* commentary line -> field int** t_travelPM */
    assert( ! strncmp(strbuffer,"# afternoon/PM travel time",26) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip,&(modelData->t_travelPM),modelData->nC) );
+   SCIP_CALL( allocTravelMatrix(scip,&(modelData->t_travelPM),modelData->nC) );
    assert( modelData->t_travelPM != NULL );
    for( i = 0; i < modelData->nC; i++ ) /* from... */
    {
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip,&(modelData->t_travelPM[i]),modelData->nC) );
-      assert( modelData->t_travelPM[i] != NULL );
       (void)! fgets(strbuffer, MAXSTRLEN, inFILE);
       k = 0;
       j = 0;
@@ -3029,12 +3397,10 @@ SCIP_RETCODE readModelData(
    /* average travel time matrix */
    (void)! fgets(strbuffer, MAXSTRLEN, inFILE); /* commentary line -> field int** t_travel */
    assert( ! strncmp(strbuffer,"# average travel time",21) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip,&(modelData->t_travel),modelData->nC) );
+   SCIP_CALL( allocTravelMatrix(scip,&(modelData->t_travel),modelData->nC) );
    assert( modelData->t_travel != NULL );
    for( i = 0; i < modelData->nC; i++ ) /* from... */
    {
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip,&(modelData->t_travel[i]),modelData->nC) );
-      assert( modelData->t_travel[i] != NULL );
       (void)! fgets(strbuffer, MAXSTRLEN, inFILE);
       k = 0;
       j = 0;
@@ -3055,12 +3421,10 @@ SCIP_RETCODE readModelData(
    /* max. deviations of travel times */
    (void)! fgets(strbuffer, MAXSTRLEN, inFILE); /* commentary line -> field int* t_travel_maxDev */
    assert( ! strncmp(strbuffer,"# max. deviation of (average) travel time",40) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip,&(modelData->t_travel_maxDev),modelData->nC) );
+   SCIP_CALL( allocTravelMatrix(scip,&(modelData->t_travel_maxDev),modelData->nC) );
    assert( modelData->t_travel_maxDev != NULL );
    for( i = 0; i < modelData->nC; i++ ) /* from... */
    {
-      SCIP_CALL( SCIPallocBlockMemoryArray(scip,&(modelData->t_travel_maxDev[i]),modelData->nC) );
-      assert( modelData->t_travel_maxDev[i] != NULL );
       (void)! fgets(strbuffer, MAXSTRLEN, inFILE);
       k = 0;
       j = 0;
@@ -3302,5 +3666,10 @@ SCIP_RETCODE readModelData(
 
    fclose(inFILE);
 
+   /* the time windows and neighbor lists are complete, index them by customer and day */
+   modelData->travelSlices = NULL;
+   SCIP_CALL( createWindowTable(scip, modelData) );
+   SCIP_CALL( createModelNeighborGraph(scip, modelData) );
+
    return SCIP_OKAY;
 }
@@ -11,6 +11,7 @@
 #include "probdata_vrp.h"
 #include "postprocessing_vrp.h"
 #include "pricer_vrp.h"
+#include "robustkernel_vrp.h"
 
 
 /**
@@ -50,6 +51,25 @@ SCIP_Bool nodeIsDepot(
     }
 }
 
+/** returns the travel time of an arc at a time of the day, in the periods it is constant and in the transitions between
+ *  them it changes linearly; the segment is found by comparisons instead of branches */
+static inline
+int travelTimeOfSlices(
+    const unsigned short* travel,
+    const int*      segmentStart,
+    int             transition,
+    int             time
+    )
+{
+    int segment = (time >= segmentStart[1]) + (time >= segmentStart[2]) + (time >= segmentStart[3])
+                + (time >= segmentStart[4]) + (time >= segmentStart[5]) + (time >= segmentStart[6]);
+    /* a period has the same slice before and after, a transition goes from one slice to the next */
+    int before = travel[segment >> 1];
+    int after = travel[(segment + 1) >> 1];
+
+    return before + (after - before) * (time - segmentStart[segment]) / transition;
+}
+
 /**
  * Computes the daytime dependet traveltime from one customer to the next
  * @param modeldata model data with all traveltimes
@@ -64,37 +84,59 @@ int getTravelTime(
     int             starttime
     )
 {
-    int traveltime;
-
     assert(modeldata != NULL);
     assert(0 <= start && start < modeldata->nC);
     assert(0 <= end && end < modeldata->nC);
-    return modeldata->t_travel[start][end];
+
     /* if time dependent travel times are deactivated, use the same value at every starttime */
-    if (!TIME_DEPENDENT_TRAVEL_TIMES)
+    if (TIME_DEPENDENT_TRAVEL_TIMES && modeldata->travelSlices != NULL)
     {
-        return modeldata->t_travel[start][end];
+        return travelTimeOfSlices(modeldata->travelSlices[start * modeldata->nC + end].travel,
+                                  modeldata->travelSegmentStart, modeldata->travelTransition, starttime);
     }
+    return modeldata->t_travel[start][end];
+}
 
-    if (starttime < NOON_START)
-    {
-        assert(modeldata->t_travelAM != NULL);
-        traveltime = modeldata->t_travelAM[start][end];
-    } 
-    else if (starttime < NOON_END)
+/**
+ * @param modeldata model data with all traveltimes
+ * @param start start node
+ * @param end end node
+ * @return maximal deviation of the travel time from start to end beyond average */
+int getTravelMaxDev(
+    model_data*     modeldata,
+    int             start,
+    int             end
+    )
+{
+    assert(modeldata != NULL);
+    assert(0 <= start && start < modeldata->nC);
+    assert(0 <= end && end < modeldata->nC);
+
+    return modeldata->t_travel_maxDev[start][end];
+}
+
+/** @return smallest travel time of an arc over the whole day, a lower bound on getTravelTime() at any time */
+int getMinTravelTime(
+    model_data*     modeldata,
+    int             start,
+    int             end
+    )
+{
+    int traveltime;
+    int k;
+
+    assert(modeldata != NULL);
+    assert(0 <= start && start < modeldata->nC);
+    assert(0 <= end && end < modeldata->nC);
+
+    if (!TIME_DEPENDENT_TRAVEL_TIMES || modeldata->travelSlices == NULL)
     {
-        assert(starttime >= NOON_START);
-        assert(modeldata->t_travelNoon != NULL);
-        traveltime = modeldata->t_travelNoon[start][end];
-    } 
-    else if (starttime < EVENING_START)
+        return getTravelTime(modeldata, start, end, modeldata->shift_start);
+    }
+    traveltime = INT_MAX;
+    for (k = 0; k < TRAVEL_SLICES; k++)
     {
-        assert(starttime >= NOON_END);
-        assert(modeldata->t_travelPM != NULL);
-        traveltime = modeldata->t_travelPM[start][end];
-    } else {
-        assert(starttime >= EVENING_START);
-        traveltime = modeldata->t_travel[start][end];
+        traveltime = MIN(traveltime, modeldata->travelSlices[start * modeldata->nC + end].travel[k]);
     }
     return traveltime;
 }
@@ -145,45 +187,26 @@ modelWindow* getNextTimeWindow(
         int             arrivaltime
     )
 {
-    modelWindow* timewindow;
-    modelWindow* rttimewindow;
+    window_table* table;
+    int i;
 
     assert(modeldata != NULL);
     assert(0 <= day && day < modeldata->nDays);
     assert(0 <= node && node < modeldata->nC);
 
-    rttimewindow = NULL;
+    table = modeldata->windowTable;
+    assert(table != NULL);
 
-    timewindow = modeldata->timeWindows[node];
-    while (timewindow != NULL)
+    /* the windows are sorted by start time, so the first one that is still open contains the arrival time or is the
+     * next one */
+    for (i = windowTableBegin(table, node, day); i < windowTableEnd(table, node, day); i++)
     {
-        if (timewindow->day != day)
-        {
-            timewindow = timewindow->next;
-            continue;
-        }
-        assert(timewindow->day == day);
-        /* lower bound of the actual time window */
-        if (timewindow->start_t <= arrivaltime && timewindow->end_t >= arrivaltime)
+        if (table->end_t[i] >= arrivaltime)
         {
-            rttimewindow = timewindow;
-            break;
+            return table->windows[i];
         }
-        /* or lowest next time window, but search on for better ones */
-        if(rttimewindow != NULL) {
-            if (timewindow->start_t > arrivaltime && timewindow->start_t < rttimewindow->start_t)
-            {
-                rttimewindow = timewindow;
-            }
-        }else{
-            if (timewindow->start_t > arrivaltime)
-            {
-                rttimewindow = timewindow;
-            }
-        }
-        timewindow = timewindow->next;
     }
-    return rttimewindow;
+    return NULL;
 }
 
 /** Gives the worst-case arrival time at node end,
@@ -213,7 +236,7 @@ int getLatestArrival(
 
     s = modelData->t_service[start];
     s_hat = modelData->t_service_maxDev[start];
-    t_hat = modelData->t_travel_maxDev[start][end];
+    t_hat = getTravelMaxDev(modelData, start, end);
     gamma = modelData->maxDelayEvents;
     traveltime = getTravelTime(modelData, start, end, robusttime[0] + s);
 
@@ -256,29 +279,25 @@ int getNumberOfNeighbors(
 ){
     SCIP_PRICER* pricer;
     SCIP_PRICERDATA* pricerdata;
+    neighbor_graph* graph;
     int numNeighbors;
-    neighbor* nb;
+    int k;
     assert(node >= 0 && node < modelData->nC);
     assert(day >= 0 && day < modelData->nDays);
 
     pricer = SCIPfindPricer(scip, "vrp");
     assert(pricer != NULL);
     pricerdata = SCIPpricerGetData(pricer);
+    graph = pricerdata->neighborGraph;
+    assert(graph != NULL);
 
     numNeighbors = 0;
-    assert(modelData->neighbors != NULL);
-
-    nb = pricerdata->neighbors[node][day];
-
-    while (nb != NULL)
+    for (k = neighborGraphBegin(graph, node, day); k < neighborGraphEnd(graph, node, day); k++)
     {
-        if(nb->id == modelData->nC - 1)
+        if (neighborGraphHead(graph, k) != modelData->nC - 1)
         {
-            nb = nb->next;
-            continue;
+            numNeighbors++;
         }
-        numNeighbors++;
-        nb = nb->next;
     }
     return numNeighbors;
 }
@@ -294,33 +313,33 @@ SCIP_RETCODE sortNeighborsOfNode(
 ){
     SCIP_PRICER* pricer;
     SCIP_PRICERDATA* pricerdata;
+    neighbor_graph* graph;
     int i;
-    neighbor* nb = NULL;
+    int k;
 
     pricer = SCIPfindPricer(scip, "vrp");
     assert(pricer != NULL);
     pricerdata = SCIPpricerGetData(pricer);
-    /* Fill the sequence tupels */
-    assert(modelData->neighbors != NULL);
+    graph = pricerdata->neighborGraph;
+    assert(graph != NULL);
 
-    nb = pricerdata->neighbors[node][day];
-
-    for (i = 0; i < nelements; i++)
+    /* Fill the sequence tupels */
+    i = 0;
+    for (k = neighborGraphBegin(graph, node, day); k < neighborGraphEnd(graph, node, day) && i < nelements; k++)
     {
-        if(nb == NULL)
-        {
-            printf("no neighbors for customer %d on day %d\n",node,day);
-        }
-        assert(nb != NULL);
-        if (!nodeIsDepot(modelData, nb->id))
+        int head = neighborGraphHead(graph, k);
+        if (!nodeIsDepot(modelData, head))
         {
-            list[i].index = nb->id;
-            list[i].value = values[nb->id];
-        } else {
-            i--;
+            list[i].index = head;
+            list[i].value = values[head];
+            i++;
         }
-        nb = nb->next;
     }
+    if (i < nelements)
+    {
+        printf("no neighbors for customer %d on day %d\n",node,day);
+    }
+    assert(i == nelements);
 
     /* Sort the sequence by dualvalues */
     qsort(list, nelements, sizeof(list[0]), cmp_vrp);
@@ -334,36 +353,21 @@ int getNumActiveDaysOfCustomer(
         int             node
     )
 {
-    int* activeDays;
-    modelWindow* timewindow;
     int numActiveDays;
     int day;
 
     assert(node >= 0 && node < modelData->nC);
 
-    assert(modelData->timeWindows != NULL);
+    assert(modelData->windowTable != NULL);
 
-    activeDays = malloc(modelData->nDays * sizeof(int));
     numActiveDays = 0;
-
-    for(day = 0; day < modelData->nDays; day++)
-    {
-        activeDays[day] = 0;
-    }
-    timewindow = modelData->timeWindows[node];
-    while (timewindow != NULL)
-    {
-        activeDays[timewindow->day] = 1;
-        timewindow = timewindow->next;
-    }
     for(day = 0; day < modelData->nDays; day++)
     {
-        if(activeDays[day])
+        if(windowTableHasWindows(modelData->windowTable, node, day))
         {
             numActiveDays++;
         }
     }
-    free(activeDays);
 
     return numActiveDays;
 }
@@ -555,7 +559,6 @@ SCIP_RETCODE recursiveShiftNode(
     double oldobj_day1, newobj_day1;
     double oldobj_day2;
     double newsum;
-    modelWindow* window;
     SCIP_Bool isfeasible;
     SCIP_Bool need_dependence, olddayUsed, newdayUsed;
 
@@ -624,14 +627,15 @@ SCIP_RETCODE recursiveShiftNode(
                 need_dependence = TRUE;
             }
             /* try out every day the customer is available on */
-            window = modelData->timeWindows[customer];
-            while (window != NULL)
+            for (newday = 0; newday < modelData->nDays; newday++)
             {
-                newday = window->day;
+                if (!windowTableHasWindows(modelData->windowTable, customer, newday))
+                {
+                    continue;
+                }
                 /* if the old day was independent of the changed days the new must has to be dependent */
                 if(need_dependence && !usedDays[newday])
                 {
-                    window = window->next;
                     continue;
                 }
                 /* if the final recursion has been reached we can make use of addNodeToTour to add customer
@@ -708,7 +712,6 @@ SCIP_RETCODE recursiveShiftNode(
                     tourlength[newday]--;
                     if(!newdayUsed) usedDays[newday] = FALSE;
                 }
-                window = window->next;
             }
 
             /* no improvement with this customer -> check next */
@@ -751,7 +754,6 @@ SCIP_RETCODE recursiveShiftNode2(
     double oldobj_day1, newobj_day1;
     double oldobj_day2;
     double newsum;
-    modelWindow* window;
     SCIP_Bool isfeasible;
     SCIP_Bool need_dependence, olddayUsed, newdayUsed;
 
@@ -817,14 +819,15 @@ SCIP_RETCODE recursiveShiftNode2(
                     need_dependence = TRUE;
                 }
                 /* try out every day the customer is available on */
-                window = modelData->timeWindows[customer];
-                while (window != NULL)
+                for (newday = 0; newday < modelData->nDays; newday++)
                 {
-                    newday = window->day;
+                    if (!windowTableHasWindows(modelData->windowTable, customer, newday))
+                    {
+                        continue;
+                    }
                     /* if the old day was independent of the changed days the new must has to be dependent */
                     if(need_dependence && !usedDays[newday])
                     {
-                        window = window->next;
                         continue;
                     }
                     /* if the final recursion has been reached we can make use of addNodeToTour to add customer
@@ -890,7 +893,6 @@ SCIP_RETCODE recursiveShiftNode2(
                         tourlength[newday]--;
                         if(!newdayUsed) usedDays[newday] = FALSE;
                     }
-                    window = window->next;
                 }
 
                 /* no improvement with this customer -> check next */
@@ -1050,8 +1052,6 @@ SCIP_RETCODE twoNodeShift(
     int bestnewpos1, bestnewpos2;
     int numimprov = 0;
 
-    modelWindow* window;
-    modelWindow* window2;
     SCIP_PRICER* pricer;
     SCIP_PRICERDATA* pricerdata;
 
@@ -1111,11 +1111,12 @@ SCIP_RETCODE twoNodeShift(
                 continue;
             }
 
-            window = modelData->timeWindows[currentnode];
-            assert(window != NULL);
-            while (window != NULL)
+            for (day2 = 0; day2 < modelData->nDays; day2++)
             {
-                day2 = window->day;
+                if (!windowTableHasWindows(modelData->windowTable, currentnode, day2))
+                {
+                    continue;
+                }
                 for (pos1 = 0; pos1 < tourlength[day2]; pos1++) {
                     oldobj2 = tourobj[day2];
                     if(day2 == day1)
@@ -1150,9 +1151,10 @@ SCIP_RETCODE twoNodeShift(
                             continue;
                         }
                     }
-                    window2 = modelData->timeWindows[node];
-                    while (window2 != NULL) {
-                        day3 = window2->day;
+                    for (day3 = 0; day3 < modelData->nDays; day3++) {
+                        if (!windowTableHasWindows(modelData->windowTable, node, day3)) {
+                            continue;
+                        }
                         for(pos = 0; pos < tourlength[day3]; pos++)
                         {
                             if(day3 == day1)
@@ -1199,7 +1201,6 @@ SCIP_RETCODE twoNodeShift(
                                 bestnewobj2 = newobj3;
                             }
                         }
-                        window2 = window2->next;
                     }
                     if(day1 == day2)
                     {
@@ -1208,7 +1209,6 @@ SCIP_RETCODE twoNodeShift(
                         tours[day2][pos1] = node;
                     }
                 }
-                window = window->next;
             }
             if(bestimprovement > 0.0)
             {
@@ -1272,7 +1272,6 @@ SCIP_RETCODE shiftNodes(
     SCIP_Bool changed;
     int* visited;
 
-    modelWindow* window;
 
     assert(modelData != NULL);
     assert(modelData->timeWindows != NULL);
@@ -1325,11 +1324,12 @@ SCIP_RETCODE shiftNodes(
                 continue;
             }
 
-            window = modelData->timeWindows[currentnode];
-            assert(window != NULL);
-            while (window != NULL)
+            for (day = 0; day < modelData->nDays; day++)
             {
-                day = window->day;
+                if (!windowTableHasWindows(modelData->windowTable, currentnode, day))
+                {
+                    continue;
+                }
                 oldobj = tourobj[day];
                 tmplength = tourlength[day];
                 k = 0;
@@ -1354,7 +1354,6 @@ SCIP_RETCODE shiftNodes(
                         bestpos = newpos;
                     }
                 }
-                window = window->next;
             }
             if (bestimprovement > 0.0)
             {
@@ -1428,8 +1427,6 @@ SCIP_RETCODE addUnvisitedNodes(
     int day2;
     int pos;
     double obj;
-    modelWindow* window;
-    modelWindow* window2;
     SCIP_Bool isfeasible;
     SCIP_Bool foundExchange;
     int duration;
@@ -1441,10 +1438,11 @@ SCIP_RETCODE addUnvisitedNodes(
     for(currentnode = 0; currentnode < nC - 1; currentnode++)
     {
         if(dayofnode[currentnode] == -1) { // check every unvisited customer
-            window = modelData->timeWindows[currentnode];
             foundExchange = FALSE;
-            while (window != NULL) {
-                day = window->day;
+            for (day = 0; day < modelData->nDays; day++) {
+                if (!windowTableHasWindows(modelData->windowTable, currentnode, day)) {
+                    continue;
+                }
                 if(isGreedy) // first: try out every possible spot in the daily tour - already checked in dispatching heuristic
                 {
                     if (addNodeToTour(scip, modelData, tours[day], &tourlength[day], &tourobj[day], currentnode, day,
@@ -1464,10 +1462,12 @@ SCIP_RETCODE addUnvisitedNodes(
                         tours[day][pos] = node;
                         continue;
                     }
-                    window2 = modelData->timeWindows[node];
-                    while (window2 != NULL) // find a new spot for the exchanged customer
+                    for (day2 = 0; day2 < modelData->nDays; day2++) // find a new spot for the exchanged customer
                     {
-                        day2 = window2->day;
+                        if (!windowTableHasWindows(modelData->windowTable, node, day2))
+                        {
+                            continue;
+                        }
                         if (addNodeToTour(scip, modelData, tours[day2], &tourlength[day2], &tourobj[day2], node,
                                           day2, NULL, SCIP_DEFAULT_INFINITY))
                         { // if a valid new spot has been found, apply this exchange
@@ -1480,14 +1480,12 @@ SCIP_RETCODE addUnvisitedNodes(
                             }
                             break;
                         }
-                        window2 = window2->next;
                     }
                     if (foundExchange) break;
                     tours[day][pos] = node; // undo exchange if no new valid spot has been found
                 }
 
                 if(foundExchange) break;
-                window = window->next;
             }
         }
 
@@ -1516,6 +1514,8 @@ SCIP_RETCODE updateRobustTimes(
     int traveltime = getTravelTime(modelData, start, end, serviceEnd);
     int earliestArrival = serviceEnd + traveltime;
     int no_dev, t_dev, s_dev, double_dev;
+    int t_hat;
+    int gammaMax = modelData->maxDelayEvents;
     modelWindow* window = getNextTimeWindow(modelData, end, day, earliestArrival);
 
     *isfeasible = TRUE;
@@ -1538,39 +1538,30 @@ SCIP_RETCODE updateRobustTimes(
     earliestService = window->start_t;
     serviceAndTraveltime = modelData->t_service[start] + traveltime;
     no_dev = serviceAndTraveltime;
-    t_dev = serviceAndTraveltime + modelData->t_travel_maxDev[start][end];
+    t_hat = getTravelMaxDev(modelData, start, end);
+    t_dev = serviceAndTraveltime + t_hat;
     s_dev = serviceAndTraveltime + modelData->t_service_maxDev[start];
-    double_dev = serviceAndTraveltime + modelData->t_service_maxDev[start] + modelData->t_travel_maxDev[start][end];
-    for (gamma = modelData->maxDelayEvents; gamma >= 0; gamma--)
+    double_dev = serviceAndTraveltime + modelData->t_service_maxDev[start] + t_hat;
+    /* Case: startnode is the depot */
+    if (start == modelData->nC - 1)
     {
-        /* Case: startnode is the depot */
-        if (start == modelData->nC - 1)
+        robustTimes[0] = maxInt(earliestService, modelData->shift_start + traveltime);
+        /* directly after the depot could only be a exactly one delay: travel time */
+        for (gamma = 1; gamma <= gammaMax; gamma++)
         {
-            robustTimes[gamma] = max(2, earliestService, modelData->shift_start + traveltime);
-            /* directly after the depot could only be a exactly one delay: travel time */
-            if (gamma > 0)
-            {
-                robustTimes[gamma] += modelData->t_travel_maxDev[start][end];
-            }
-        }
-        /* Case: arrivaltimes without deviations */
-        else if (gamma == 0)
-        {
-            /* a_j = Y_{i0} + s_i + t_{ij} */
-            robustTimes[gamma] = max(2, earliestService, earliestArrival);
-        }
-        /* Case: arrivaltimes with exactly one deviations */
-        else if (gamma == 1)
-        {
-            robustTimes[gamma] = max(4, earliestService, no_dev + robustTimes[1], t_dev + robustTimes[0], s_dev + robustTimes[0]);
-        }
-        /* All other cases */
-        else
-        {
-            robustTimes[gamma] = max(5, earliestService, no_dev + robustTimes[gamma], t_dev + robustTimes[gamma - 1],
-                                     s_dev + robustTimes[gamma - 1], double_dev + robustTimes [gamma - 2]);
+            robustTimes[gamma] = robustTimes[0] + t_hat;
         }
     }
+    /* a_j = Y_{i0} + s_i + t_{ij} without deviations, the deviations of travel and service time are added to the
+     * arrivals with fewer delays; the recurrence is specialized for the number of delays */
+    else if (gammaMax <= ROBUST_KERNEL_MAXGAMMA)
+    {
+        robustTimesKernels[gammaMax](robustTimes, earliestService, no_dev, maxInt(t_dev, s_dev), double_dev);
+    }
+    else
+    {
+        robustTimesRecurrence(robustTimes, gammaMax, earliestService, no_dev, maxInt(t_dev, s_dev), double_dev);
+    }
 
     /* check that arrival times are in ascending order */
     #ifndef NDEBUG
@@ -1721,8 +1712,9 @@ int getEdgeArray(
     int numedges;
     int** costMatrix;
     int** edgeIndex;
-    neighbor* nb;
+    neighbor_graph* graph = modeldata->neighborGraph;
     int index;
+    int k;
 
     nC = modeldata->nC;
 
@@ -1746,27 +1738,26 @@ int getEdgeArray(
         }
     }
     numedges = 0;
-    if(modeldata->neighbors != NULL)
+    if(graph != NULL)
     {
         for(i = 0; i < nC; i++)
         {
             for(j = 0; j < modeldata->nDays; j++)
             {
-                nb = modeldata->neighbors[i][j];
-                while(nb != NULL)
+                for(k = neighborGraphBegin(graph, i, j); k < neighborGraphEnd(graph, i, j); k++)
                 {
-                    index = edgeIndex[i][nb->id] - 1;
+                    int head = neighborGraphHead(graph, k);
+                    index = edgeIndex[i][head] - 1;
                     if(index == -1)
                     {
-                        sortededges[numedges].index = nC * i + nb->id;
-                        sortededges[numedges++].value = costMatrix[i][nb->id];
-                        edgeIndex[i][nb->id] = numedges;
-                        edgeIndex[nb->id][i] = numedges;
-                    }else if(sortededges[index].value > costMatrix[i][nb->id])
+                        sortededges[numedges].index = nC * i + head;
+                        sortededges[numedges++].value = costMatrix[i][head];
+                        edgeIndex[i][head] = numedges;
+                        edgeIndex[head][i] = numedges;
+                    }else if(sortededges[index].value > costMatrix[i][head])
                     {
-                        sortededges[index].value = costMatrix[i][nb->id];
+                        sortededges[index].value = costMatrix[i][head];
                     }
-                    nb = nb->next;
                 }
             }
         }
@@ -1879,24 +1870,25 @@ SCIP_RETCODE computeStaticDualbound(
    for (i = 0; i < modeldata->nC; i++)
    {
       int lowest = INT_MAX;
-      if (modeldata->neighbors != NULL)
+      if (modeldata->neighborGraph != NULL)
       {
+         neighbor_graph* graph = modeldata->neighborGraph;
          int day;
          for (day = 0; day < modeldata->nDays; day++)
          {
             int lowestday = INT_MAX;
-            neighbor* node = modeldata->neighbors[i][day];
-            while(node != NULL)
+            int k;
+            for (k = neighborGraphBegin(graph, i, day); k < neighborGraphEnd(graph, i, day); k++)
             {
-               if (lowest > modeldata->t_travel[i][node->id])
+               int traveltime = getMinTravelTime(modeldata, i, neighborGraphHead(graph, k));
+               if (lowest > traveltime)
                {
-                  lowest = modeldata->t_travel[i][node->id];
+                  lowest = traveltime;
                }
-               if( lowestday > modeldata->t_travel[i][node->id])
+               if( lowestday > traveltime)
                {
-                     lowestday = modeldata->t_travel[i][node->id];
+                     lowestday = traveltime;
                }
-               node = node->next;
             }
             probdata->shortestEdge[day][i] = lowestday;
          }
@@ -1907,9 +1899,9 @@ SCIP_RETCODE computeStaticDualbound(
             {
                continue;
             }
-            if (lowest > modeldata->t_travel[i][j])
+            if (lowest > getMinTravelTime(modeldata, i, j))
             {
-               lowest = modeldata->t_travel[i][j];
+               lowest = getMinTravelTime(modeldata, i, j);
             }
          }
       }
@@ -0,0 +1,110 @@
+/**@file   warmstart_vrp.c
+ * @brief  paths of the best labels of the last exact labeling of each day, they seed the labeling of the next round
+ * @author Lukas Schürmann, University Bonn
+ */
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "warmstart_vrp.h"
+
+/**
+ * Interface functions
+ */
+
+/** Creates an empty warm start */
+extern
+SCIP_RETCODE warmStartCreate(
+    SCIP*           scip,
+    warm_start**    warmstart,
+    int             nDays,
+    int             maxpaths,
+    int             maxlength
+    )
+{
+    int day;
+
+    assert(scip != NULL);
+    assert(warmstart != NULL);
+    assert(nDays > 0);
+    assert(maxpaths > 0);
+    assert(maxlength > 0);
+
+    SCIP_CALL( SCIPallocMemory(scip, warmstart) );
+    (*warmstart)->nDays = nDays;
+    (*warmstart)->maxpaths = maxpaths;
+    (*warmstart)->maxlength = maxlength;
+
+    SCIP_CALL( SCIPallocMemoryArray(scip, &(*warmstart)->paths, nDays) );
+    SCIP_CALL( SCIPallocMemoryArray(scip, &(*warmstart)->lengths, nDays) );
+    SCIP_CALL( SCIPallocClearMemoryArray(scip, &(*warmstart)->npaths, nDays) );
+    for (day = 0; day < nDays; day++)
+    {
+        SCIP_CALL( SCIPallocMemoryArray(scip, &(*warmstart)->paths[day], maxpaths * maxlength) );
+        SCIP_CALL( SCIPallocMemoryArray(scip, &(*warmstart)->lengths[day], maxpaths) );
+    }
+
+    return SCIP_OKAY;
+}
+
+/** Frees a warm start */
+extern
+void warmStartFree(
+    SCIP*           scip,
+    warm_start**    warmstart
+    )
+{
+    int day;
+
+    assert(warmstart != NULL);
+    assert(*warmstart != NULL);
+
+    for (day = 0; day < (*warmstart)->nDays; day++)
+    {
+        SCIPfreeMemoryArray(scip, &(*warmstart)->lengths[day]);
+        SCIPfreeMemoryArray(scip, &(*warmstart)->paths[day]);
+    }
+    SCIPfreeMemoryArray(scip, &(*warmstart)->npaths);
+    SCIPfreeMemoryArray(scip, &(*warmstart)->lengths);
+    SCIPfreeMemoryArray(scip, &(*warmstart)->paths);
+    SCIPfreeMemory(scip, warmstart);
+}
+
+/** Removes all paths of a day */
+extern
+void warmStartClear(
+    warm_start*     warmstart,
+    int             day
+    )
+{
+    assert(warmstart != NULL);
+    assert(0 <= day && day < warmstart->nDays);
+
+    warmstart->npaths[day] = 0;
+}
+
+/** Adds the path of a label to the paths of its day, nothing happens if the day is full or the path too long */
+extern
+void warmStartAddLabel(
+    warm_start*     warmstart,
+    labelVrp*       label
+    )
+{
+    int day;
+    int i;
+
+    assert(warmstart != NULL);
+    assert(label != NULL);
+
+    day = label->day;
+    assert(0 <= day && day < warmstart->nDays);
+
+    if (warmstart->npaths[day] >= warmstart->maxpaths || label->nvisitednodes == 0
+        || label->nvisitednodes > warmstart->maxlength)
+    {
+        return;
+    }
+    i = warmstart->npaths[day]++;
+    labelVrpGetPath(label, warmStartGetPath(warmstart, day, i));
+    warmstart->lengths[day][i] = label->nvisitednodes;
+}